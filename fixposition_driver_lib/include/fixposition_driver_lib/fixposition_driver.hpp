@@ -16,14 +16,19 @@
 
 /* LIBC/STL */
 #include <array>
+#include <atomic>
+#include <condition_variable>
 #include <cstdint>
+#include <deque>
 #include <functional>
+#include <memory>
+#include <mutex>
 #include <string>
 #include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 /* EXTERNAL */
-#include <poll.h>
 #include <termios.h>
 
 #include <boost/core/noncopyable.hpp>
@@ -35,8 +40,13 @@
 #include <fpsdk_common/thread.hpp>
 
 /* PACKAGE */
+#include "fixposition_driver_lib/buffer_pool.hpp"
 #include "fixposition_driver_lib/helper.hpp"
+#include "fixposition_driver_lib/latency_histogram.hpp"
 #include "fixposition_driver_lib/params.hpp"
+#include "fixposition_driver_lib/raw_recorder.hpp"
+#include "fixposition_driver_lib/shm_output.hpp"
+#include "fixposition_driver_lib/spsc_queue.hpp"
 
 namespace fixposition {
 /* ****************************************************************************************************************** */
@@ -48,6 +58,11 @@ namespace fixposition {
  * which can be used by consumers by observing ("subscribing to") the driver. On various events, such as receiving
  * a new message or completing and "epoch", the observers are notified by the driver. The driver also handles sending
  * data to the sensor, namely GNSS correction data (typically, RTCM3 messages) or measurements, such as wheelspeed.
+ *
+ * Besides the main sensor stream the driver can ingest additional (read-only) input streams, for example the sensor's
+ * second TCP output port or a second sensor (see DriverParams::extra_streams_). All streams are multiplexed in one
+ * event loop and share the worker, dispatch and TX threads; each stream has its own parser and observers are
+ * registered per stream (stream 0 = the main stream). Sending data always goes to the main stream.
  */
 class FixpositionDriver : private boost::noncopyable {
    public:
@@ -87,42 +102,148 @@ class FixpositionDriver : private boost::noncopyable {
     //! Observer function for NMEA messages
     using NmeaObserver = std::function<void(const fpsdk::common::parser::nmea::NmeaPayload&)>;
 
+    //! Consuming observer function for NMEA messages. It runs after all NmeaObservers and receives the decoded
+    //! payload as an rvalue, so it may move the payload (or parts of it) instead of copying it.
+    using NmeaConsumer = std::function<void(fpsdk::common::parser::nmea::NmeaPayload&&)>;
+
     //! Observer function for NOV_B messages
     using NovbObserver = std::function<void(const fpsdk::common::parser::novb::NovbHeader*, const uint8_t*)>;
 
     //! Observer function for raw parser messages
     using RawObserver = std::function<void(const fpsdk::common::parser::ParserMsg&)>;
 
+    //! Ref-counted view of a raw parser message. Observers may keep a copy of the pointer to hold on to the message
+    //! (and its buffer) without copying the data; the buffer returns to the driver's pool once the last user lets go.
+    using SharedParserMsg = std::shared_ptr<const fpsdk::common::parser::ParserMsg>;
+
+    //! Observer function for ref-counted raw parser messages
+    using SharedRawObserver = std::function<void(const SharedParserMsg&)>;
+
+    static constexpr std::size_t NUM_FPA_MSGS = 14;  //!< Number of known FP_A messages (see dispatch table in .cpp)
+    static constexpr std::size_t NUM_NMEA_MSGS = 9;  //!< Number of known NMEA formatters (see dispatch table in .cpp)
+
     /**
      * @brief Add observer for FP_A message
      *
      * @param[in]  message_name   The message name to observe, e.g. "FP_A-ODOMETRY"
      * @param[in]  observer       The function to call to process the message
+     * @param[in]  stream         The stream to observe (0 = main stream, 1..N = extra streams)
      */
-    void AddFpaObserver(const std::string& message_name, FpaObserver observer);
+    void AddFpaObserver(const std::string& message_name, FpaObserver observer, const std::size_t stream = 0);
 
     /**
      * @brief Add observer for NMEA message
      *
      * @param[in]  formatter  The formatter for the messages to observe, e.g. "GGA"
      * @param[in]  observer   The function to call to process the message
+     * @param[in]  stream     The stream to observe (0 = main stream, 1..N = extra streams)
      */
-    void AddNmeaObserver(const std::string& formatter, NmeaObserver observer);
+    void AddNmeaObserver(const std::string& formatter, NmeaObserver observer, const std::size_t stream = 0);
+
+    /**
+     * @brief Add observer for FP_A message, typed
+     *
+     * The message name is resolved from the payload type (PayloadT::MSG_NAME) at compile time and the observer is
+     * invoked with the concrete payload type. So unlike with the string-based registration above, the registration
+     * site and the observer cannot disagree on the type, and the observer needs no dynamic_cast of the payload.
+     *
+     * @tparam     PayloadT  The FP_A payload type to observe, e.g. fpsdk::common::parser::fpa::FpaOdometryPayload
+     *
+     * @param[in]  observer  The function to call to process the message
+     * @param[in]  stream    The stream to observe (0 = main stream, 1..N = extra streams)
+     */
+    template <typename PayloadT>
+    void AddFpaObserver(std::function<void(const PayloadT&)> observer, const std::size_t stream = 0) {
+        // The dispatch decodes exactly the PayloadT registered for this message name, so the downcast is static
+        AddFpaObserver(
+            PayloadT::MSG_NAME,
+            [observer](const fpsdk::common::parser::fpa::FpaPayload& payload) {
+                observer(static_cast<const PayloadT&>(payload));
+            },
+            stream);
+    }
+
+    /**
+     * @brief Add observer for NMEA message, typed
+     *
+     * Like the typed AddFpaObserver() above, but for NMEA messages (the formatter is resolved from
+     * PayloadT::FORMATTER at compile time).
+     *
+     * @tparam     PayloadT  The NMEA payload type to observe, e.g. fpsdk::common::parser::nmea::NmeaGgaPayload
+     *
+     * @param[in]  observer  The function to call to process the message
+     * @param[in]  stream    The stream to observe (0 = main stream, 1..N = extra streams)
+     */
+    template <typename PayloadT>
+    void AddNmeaObserver(std::function<void(const PayloadT&)> observer, const std::size_t stream = 0) {
+        AddNmeaObserver(
+            PayloadT::FORMATTER,
+            [observer](const fpsdk::common::parser::nmea::NmeaPayload& payload) {
+                observer(static_cast<const PayloadT&>(payload));
+            },
+            stream);
+    }
+
+    /**
+     * @brief Set the consuming observer for a NMEA message
+     *
+     * At most one consumer can be set per message (per stream). It is called after all observers added with
+     * AddNmeaObserver() and is handed the decoded payload as an rvalue, so unlike an observer it may move the
+     * payload into its own storage (e.g. an epoch collector) instead of copying it.
+     *
+     * @param[in]  formatter  The formatter for the messages to consume, e.g. "GGA"
+     * @param[in]  consumer   The function to call to consume the message
+     * @param[in]  stream     The stream to observe (0 = main stream, 1..N = extra streams)
+     */
+    void SetNmeaConsumer(const std::string& formatter, NmeaConsumer consumer, const std::size_t stream = 0);
+
+    /**
+     * @brief Set the consuming observer for a NMEA message, typed
+     *
+     * Like the typed AddNmeaObserver() above, but for the consuming observer (see the string-based
+     * SetNmeaConsumer() for the semantics).
+     *
+     * @tparam     PayloadT  The NMEA payload type to consume, e.g. fpsdk::common::parser::nmea::NmeaGgaPayload
+     *
+     * @param[in]  consumer  The function to call to consume the message
+     * @param[in]  stream    The stream to observe (0 = main stream, 1..N = extra streams)
+     */
+    template <typename PayloadT>
+    void SetNmeaConsumer(std::function<void(PayloadT&&)> consumer, const std::size_t stream = 0) {
+        SetNmeaConsumer(
+            PayloadT::FORMATTER,
+            [consumer](fpsdk::common::parser::nmea::NmeaPayload&& payload) {
+                consumer(static_cast<PayloadT&&>(payload));
+            },
+            stream);
+    }
 
     /**
      * @brief Add observer for NOV_B message
      *
      * @param[in]  message_name   The message name to observe, e.g. "NOV_B-BESTGNSSPOS"
      * @param[in]  observer       The function to call to process the message
+     * @param[in]  stream         The stream to observe (0 = main stream, 1..N = extra streams)
      */
-    void AddNovbObserver(const std::string& message_name, NovbObserver observer);
+    void AddNovbObserver(const std::string& message_name, NovbObserver observer, const std::size_t stream = 0);
 
     /**
      * @brief Add observer for raw parser messages
      *
      * @param[in]  observer  The function to call to process the message
+     * @param[in]  stream    The stream to observe (0 = main stream, 1..N = extra streams)
+     */
+    void AddRawObserver(RawObserver observer, const std::size_t stream = 0);
+
+    /**
+     * @brief Add observer for ref-counted raw parser messages
+     *
+     * Unlike AddRawObserver(), the observer receives a ref-counted view of the message and can hold on to it beyond
+     * the callback without copying the data. These observers receive the messages of all streams.
+     *
+     * @param[in]  observer  The function to call to process the message
      */
-    void AddRawObserver(RawObserver observer);
+    void AddSharedRawObserver(SharedRawObserver observer);
 
     /**
      * @brief Remove all observers for FP_A messages
@@ -144,9 +265,118 @@ class FixpositionDriver : private boost::noncopyable {
      */
     void RemoveRawObservers();
 
+    /**
+     * @brief Enable or disable the processing of a message at runtime
+     *
+     * Disabled messages are discarded right after framing (like messages without observers, see the skip logic in
+     * MsgWanted()), so they cost neither decoding nor dispatch while their observers stay registered. This allows
+     * e.g. switching high-rate messages on only for diagnostics without restarting the driver. Like all observer
+     * set updates this is applied atomically (see UpdateObserverSet()) and never blocks the data path.
+     *
+     * Note that raw observers (AddRawObserver(), AddSharedRawObserver()) see all messages regardless, but the
+     * decoded-message observers of a disabled message are not called either way.
+     *
+     * @param[in]  message  The message name (e.g. "FP_A-ODOMETRY") resp. NMEA formatter (e.g. "GGA"), same
+     *                      convention as DriverParams::messages_
+     * @param[in]  enable   true to (re-)enable, false to disable the message
+     */
+    void SetMessageEnabled(const std::string& message, const bool enable);
+
+    /**
+     * @brief Replace the entire set of runtime-disabled messages in one atomic update
+     *
+     * See SetMessageEnabled() for the semantics. Messages not in the list are (re-)enabled.
+     *
+     * @param[in]  messages  The message names resp. NMEA formatters to disable
+     */
+    void SetDisabledMessages(const std::vector<std::string>& messages);
+
+    /**
+     * @brief Statistics on the sensor read (ingest) path
+     */
+    struct ReadStats {
+        uint64_t num_reads_ = 0;    //!< Number of successful read()/recv() calls
+        uint64_t num_bytes_ = 0;    //!< Total number of bytes read
+        std::size_t max_read_ = 0;  //!< Largest single read [bytes]
+    };
+
+    /**
+     * @brief Get statistics on the sensor read path (bytes per read = num_bytes_ / num_reads_, which should be
+     *        considerably larger than the average message size when the sensor streams at high rates)
+     *
+     * @returns a copy of the current read statistics
+     */
+    ReadStats GetReadStats() const;
+
+    /**
+     * @brief Statistics on the parse-to-dispatch message queue
+     */
+    struct QueueStats {
+        std::size_t depth_ = 0;           //!< Current queue depth
+        std::size_t high_watermark_ = 0;  //!< Highest queue depth seen
+        uint64_t num_dropped_ = 0;        //!< Number of messages dropped (oldest-first) due to a full queue
+        uint64_t num_skipped_ = 0;        //!< Number of framed messages discarded undecoded (no observer registered)
+        uint64_t num_decimated_ = 0;      //!< Number of framed messages discarded undecoded by decimation
+    };
+
+    /**
+     * @brief Get statistics on the parse-to-dispatch message queue
+     *
+     * @returns a copy of the current queue statistics
+     */
+    QueueStats GetQueueStats() const;
+
+    /**
+     * @brief Statistics on the sensor write (TX) path
+     */
+    struct TxStats {
+        uint64_t num_sent_ = 0;     //!< Number of messages written to the sensor
+        uint64_t num_dropped_ = 0;  //!< Number of messages dropped (oldest-first) due to a full TX queue
+        uint64_t num_failed_ = 0;   //!< Number of failed writes
+    };
+
+    /**
+     * @brief Get statistics on the sensor write path
+     *
+     * @returns a copy of the current TX statistics
+     */
+    TxStats GetTxStats() const;
+
+    /**
+     * @brief Latency statistics on the receive path
+     *
+     * All latencies are measured from the Read() that completed the message, i.e. they include queueing, decoding and
+     * the observers (which for the ROS nodes includes the middleware publish).
+     */
+    struct LatencyStats {
+        LatencyHistogram::Stats parse_;          //!< Receive to parsed (message queued for dispatch)
+        LatencyHistogram::Stats dispatch_fpa_;   //!< Receive to all FP_A observers done
+        LatencyHistogram::Stats dispatch_nmea_;  //!< Receive to all NMEA observers done
+        LatencyHistogram::Stats dispatch_novb_;  //!< Receive to all NOV_B observers done
+    };
+
+    /**
+     * @brief All driver statistics
+     */
+    struct Stats {
+        ReadStats read_;        //!< Sensor read path statistics
+        QueueStats queue_;      //!< Parse-to-dispatch queue statistics
+        TxStats tx_;            //!< Sensor write path statistics
+        LatencyStats latency_;  //!< Receive path latency statistics
+    };
+
+    /**
+     * @brief Get all driver statistics in one go, for periodic (low-rate) diagnostics output
+     *
+     * @returns a copy of the current statistics
+     */
+    Stats GetStats() const;
+
     /**
      * @brief Send correction data to sensor
      *
+     * The data is queued for the TX thread and written to the sensor asynchronously (fire-and-forget).
+     *
      * @param[in]  msg   The raw message data (e.g. a RTCM3 message)
      * @param[in]  size  Size of the raw message
      */
@@ -155,6 +385,9 @@ class FixpositionDriver : private boost::noncopyable {
     /**
      * @brief Send wheelspeed data to sensor
      *
+     * The data is queued for the TX thread and written to the sensor asynchronously (fire-and-forget). Wheelspeed
+     * measurements take priority over queued correction data.
+     *
      * @param[in]  data  The wheelspeed data
      */
     void SendWheelspeedData(const std::vector<WheelSpeedData>& data);
@@ -207,31 +440,180 @@ class FixpositionDriver : private boost::noncopyable {
     virtual bool Write(const uint8_t* buf, const std::size_t size);
 
    private:
-    // Sensor connection
-    bool ConnectTcp(const std::string& ip, const int port);      //!< Connect() for TCP
-    void DisconnectTcp();                                        //!< Disconnect() for TCP
-    bool ConnectSerial(const std::string& dev, const int baud);  //!< Connect() for serial
-    void DisconnectSerial();                                     //!< Disconnect() for serial
-    bool serial_ = false;                                        //!< Serial (true) or TCP client (false)
-    int sensor_fd_ = -1;                                         //!< TCP or serial file descriptor
-    std::string sensor_name_;                                    //!< Name of the sensor, for debugging
-    std::array<struct pollfd, 1> poll_fds_;                      //!< poll() config
-    struct termios options_save_;                                //!< Saved serial port parameters
-
-    // Worker thread
+    // Sensor connection. The Open/Close helpers are shared between the main stream and the extra streams below.
+    //! Open a stream ("tcpcli://..." or "serial://..."), @returns the fd, or -1 on failure
+    int OpenStream(const std::string& spec, bool& serial, struct termios& options_save);
+    //! OpenStream() for TCP
+    int OpenTcp(const std::string& spec, const std::string& ip, const int port);
+    //! Start a non-blocking TCP connect, @returns the fd with the connect in progress (or completed), or -1 on failure
+    int StartTcpConnect(const std::string& spec, const std::string& ip, const int port);
+    //! Wait for a pending TCP connect to complete, @returns true on success (the fd is closed on failure)
+    bool FinishTcpConnect(const std::string& spec, const int fd, const int timeout);
+    //! Enable TCP keepalive and user-timeout, so that dead links are detected within seconds instead of never
+    void SetupTcpAliveness(const std::string& spec, const int fd);
+    //! OpenStream() for serial
+    int OpenSerial(const std::string& spec, const std::string& dev, const int baud, struct termios& options_save);
+    //! Connect() for file replay ("file://...", main stream only)
+    int OpenFile(const std::string& spec, const std::string& path);
+    //! Close a stream fd (restoring the serial port parameters for serial streams)
+    void CloseStream(const int fd, const bool serial, const struct termios& options_save);
+    bool serial_ = false;           //!< Serial (true) or TCP client (false)
+    bool file_ = false;             //!< File replay ("file://...") instead of a live sensor connection
+    bool replay_done_ = false;      //!< File replay reached EOF, the worker ends instead of reconnecting
+    int sensor_fd_ = -1;            //!< TCP, serial or file descriptor
+    std::string sensor_name_;       //!< Name of the sensor, for debugging
+    struct termios options_save_;   //!< Saved serial port parameters
+
+    // Non-blocking reconnect for the main stream (see Reconnect()). A lost connection is re-established with an
+    // O_NONBLOCK connect() whose completion is detected through the epoll set, so the worker never hangs on an
+    // unreachable sensor and a shutdown request is honoured immediately. Attempts are paced by an exponential
+    // backoff with jitter, bounded by DriverParams::reconnect_delay_ resp. reconnect_delay_max_.
+    bool Reconnect();                //!< Drive the reconnect state machine, @returns false on a pending abort
+    void ScheduleReconnect();        //!< Schedule the next connect attempt, growing the backoff
+    int connect_fd_ = -1;            //!< TCP fd with a connect in progress (registered for EPOLLOUT), -1 = none
+    uint64_t connect_deadline_ = 0;  //!< Give up on the pending connect at this time [ns]
+    uint64_t next_connect_ = 0;      //!< Earliest time for the next connect attempt [ns]
+    double connect_backoff_ = 0.0;   //!< Current backoff delay [s], 0.0 = start over at reconnect_delay_
+
+    //! An additional (read-only) input stream, with its own connection, parser and statistics
+    struct ExtraStream {
+        std::string spec_;                      //!< Stream spec ("tcpcli://..." or "serial://...")
+        int fd_ = -1;                           //!< TCP or serial file descriptor (-1 = not connected)
+        bool serial_ = false;                   //!< Serial (true) or TCP client (false)
+        struct termios options_save_;           //!< Saved serial port parameters
+        fpsdk::common::parser::Parser parser_;  //!< Per-stream protocol parser
+        ReadStats read_stats_;                  //!< Per-stream read statistics
+    };
+    std::vector<std::unique_ptr<ExtraStream>> extra_streams_;  //!< Extra input streams (stream indices 1..N)
+    std::vector<std::size_t> extra_readable_;  //!< Extra streams flagged readable by Read(), serviced by the worker
+    void ReadExtraStream(const std::size_t stream_ix);  //!< Read and parse pending data on an extra stream
+
+    // Event loop for the worker. The sensor fd and a wakeup eventfd are registered in an epoll set, so that the
+    // worker only ever wakes up when data has arrived or a shutdown is pending -- no periodic timeout polling, zero
+    // wakeups when the sensor is idle. Further fds (e.g. a second stream) can be added to the set as needed.
+    int epoll_fd_ = -1;                    //!< epoll set the worker waits on
+    int wake_fd_ = -1;                     //!< eventfd to wake the worker out of epoll_wait() (for shutdown)
+    bool SetupEvents();                    //!< Create the epoll set and the wakeup eventfd
+    void TeardownEvents();                 //!< Destroy the epoll set and the wakeup eventfd
+    bool AddReadFdToEvents(const int fd);  //!< Register a fd in the epoll set for read readiness
+    std::vector<uint8_t> read_buf_;                              //!< Reusable bulk read buffer
+    //! Read path statistics counters for the main stream. Written by the worker thread only, but read by
+    //! GetReadStats() from any thread, hence atomics (relaxed: monotonic counters, no ordering needed).
+    struct ReadStatsCounters {
+        std::atomic<uint64_t> num_reads_{0};    //!< see ReadStats::num_reads_
+        std::atomic<uint64_t> num_bytes_{0};    //!< see ReadStats::num_bytes_
+        std::atomic<std::size_t> max_read_{0};  //!< see ReadStats::max_read_
+    };
+    ReadStatsCounters read_stats_;  //!< Read path statistics
+    //! Raw stream recorder for the main stream, enabled via DriverParams::raw_record_path_ (see RawRecorder)
+    std::unique_ptr<RawRecorder> raw_recorder_;
+    //! Shared-memory output of the latest navigation state, enabled via DriverParams::shm_output_ (see ShmOutput)
+    std::unique_ptr<ShmOutput> shm_output_;
+
+    // Worker (parse) and dispatch (observer) threads. The worker only reads and parses, and pushes the messages into
+    // the queue. The dispatch thread pops the messages and runs the observers. This way a blocking consumer (e.g. a
+    // slow middleware publish) cannot stall the socket/serial port draining and cause overruns.
     fpsdk::common::parser::Parser parser_;  //!< Protocol parser for incoming messages
     fpsdk::common::thread::Thread worker_;  //!< Worker thread handle
     void Worker(void* arg);                 //!< Worker thread
-
-    // Observers for received messages
-    std::unordered_map<std::string, std::vector<FpaObserver>> fpa_observers_;    //!< FP_A message observers
-    std::unordered_map<std::string, std::vector<NmeaObserver>> nmea_observers_;  //!< NMEA message observers
-    std::unordered_map<std::string, std::vector<NovbObserver>> novb_observers_;  //!< NOV_B message observers
-    std::vector<RawObserver> raw_observers_;                                     //!< Raw parser message observers
-    void NotifyFpaObservers(const fpsdk::common::parser::ParserMsg& msg);        //!< Notify FP_A message observers
-    void NotifyNmeaObservers(const fpsdk::common::parser::ParserMsg& msg);       //!< Notify NMEA message observers
-    void NotifyNovbObservers(const fpsdk::common::parser::ParserMsg& msg);       //!< Notify NOV_B message observers
-    void NotifyRawObservers(const fpsdk::common::parser::ParserMsg& msg);        //!< Notify raw message observers
+    //! Apply the configured scheduling policy/priority and CPU affinity to the calling driver thread (see
+    //! DriverParams::thread_sched_, thread_prio_ and thread_cpus_). Called by each thread as it starts.
+    void ApplyThreadSettings(const char* name);
+    //! A parsed message plus the (monotonic) timestamp of the Read() that completed it, for latency accounting
+    struct QueuedMsg {
+        fpsdk::common::parser::ParserMsg msg_;  //!< The parsed message
+        uint64_t rx_nanos_ = 0;                 //!< Monotonic receive timestamp [ns]
+        std::size_t stream_ = 0;                //!< Stream the message was received on (0 = main stream)
+    };
+    SpscQueue<QueuedMsg> msg_queue_;          //!< Parsed messages, worker -> dispatch
+    fpsdk::common::thread::Thread dispatch_;  //!< Dispatch thread handle
+    void Dispatch(void* arg);                 //!< Dispatch thread
+    //! Whether any observer is registered for a message. The worker discards unwanted messages right after framing,
+    //! so that e.g. high-rate messages removed from the config cost neither decoding nor a queue round-trip.
+    bool MsgWanted(const std::size_t stream, const fpsdk::common::parser::ParserMsg& msg) const;
+    //! Number of framed messages discarded undecoded (see MsgWanted()). Written by the worker thread, read by
+    //! GetQueueStats() from any thread, hence atomic (relaxed, like read_stats_)
+    std::atomic<uint64_t> num_msgs_skipped_{0};
+    //! Per-stream decimation state (message name to counter), built by StartDriver() from DriverParams::decimation_.
+    //! All streams are read by the worker thread (see ReadExtraStream()), so no locking is needed.
+    struct DecimState {
+        uint32_t factor_ = 1;  //!< Keep every factor-th message
+        uint32_t count_ = 0;   //!< Messages seen since the last kept one
+    };
+    std::vector<std::unordered_map<std::string, DecimState>> decimation_;  //!< Decimation state ([0] = main stream)
+    //! Whether a message falls victim to the configured decimation. Checked right after MsgWanted(), so that like
+    //! unwanted messages the decimated ones cost neither decoding nor a queue round-trip.
+    bool MsgDecimated(const std::size_t stream, const fpsdk::common::parser::ParserMsg& msg);
+    //! Number of framed messages discarded undecoded (see MsgDecimated()). Written by the worker thread, read by
+    //! GetQueueStats() from any thread, hence atomic (relaxed, like read_stats_)
+    std::atomic<uint64_t> num_msgs_decimated_{0};
+
+    // Latency histograms. The receive timestamp travels with each message through the queue (see QueuedMsg above), the
+    // worker records at push and the dispatch thread after the observers returned. The histograms are lock-free, so
+    // GetStats() can be called from any thread without disturbing the hot path.
+    LatencyHistogram parse_latency_;          //!< Receive to parsed
+    LatencyHistogram dispatch_latency_fpa_;   //!< Receive to FP_A observers done
+    LatencyHistogram dispatch_latency_nmea_;  //!< Receive to NMEA observers done
+    LatencyHistogram dispatch_latency_novb_;  //!< Receive to NOV_B observers done
+
+    // TX (write) thread. SendCorrectionData() and SendWheelspeedData() only enqueue the data, and the TX thread does
+    // the actual writes. This way a blocking write() (e.g. a draining UART at 115200 baud) cannot stall the callers
+    // (typically, middleware subscriber callbacks), and concurrent callers cannot interleave bytes on the fd. The
+    // wheelspeed queue is served before the correction data queue, so that the (small, timing-sensitive) measurements
+    // preempt bulk RTCM data. On overflow the oldest queued message is dropped, as old data is stale anyway. The frame
+    // buffers are recycled through a small pool, so that in steady state enqueueing does not allocate.
+    fpsdk::common::thread::Thread tx_worker_;        //!< TX thread handle
+    void TxWorker(void* arg);                        //!< TX thread
+    mutable std::mutex tx_mutex_;                    //!< Protects the TX queues and statistics
+    std::condition_variable tx_cond_;                //!< Signals the TX thread that data is pending
+    std::deque<std::vector<uint8_t>> tx_queue_speed_;  //!< Queued wheelspeed messages (high priority)
+    std::deque<std::vector<uint8_t>> tx_queue_corr_;   //!< Queued correction data messages (bulk)
+    TxStats tx_stats_;                               //!< TX path statistics
+    BufferPool tx_buffer_pool_;                      //!< Pool of recycled TX frame buffers
+    //! Enqueue a message for the TX thread, dropping the oldest queued message on overflow
+    void EnqueueTx(std::deque<std::vector<uint8_t>>& queue, const std::size_t capacity, std::vector<uint8_t>&& data);
+
+    // Observers for received messages, per stream ([0] = main stream, [1..N] = extra streams). The known FP_A and
+    // NMEA messages are resolved to dense integer IDs (indices into the dispatch tables, see fixposition_driver.cpp)
+    // once at registration time, so that the hot dispatch path does neither string hashing nor a linear if/else chain
+    // of string comparisons per message.
+    struct StreamObservers {
+        std::array<std::vector<FpaObserver>, NUM_FPA_MSGS> fpa_;     //!< FP_A message observers
+        std::array<std::vector<NmeaObserver>, NUM_NMEA_MSGS> nmea_;  //!< NMEA message observers
+        std::array<NmeaConsumer, NUM_NMEA_MSGS> nmea_consumer_;      //!< NMEA message consumers (at most one each)
+        std::unordered_map<std::string, std::vector<NovbObserver>> novb_;  //!< NOV_B message observers
+        std::vector<RawObserver> raw_;                                     //!< Raw parser message observers
+    };
+    //! The observer set and the runtime message skip-set. The worker and dispatch threads load the current set with
+    //! std::atomic_load() (once per message) and writers publish an updated copy with UpdateObserverSet() (RCU-style
+    //! copy-update-swap), so observers and the skip-set can be changed at runtime without ever blocking the data
+    //! path.
+    struct ObserverSet {
+        std::vector<StreamObservers> streams_;       //!< Per-stream observers ([0] = main stream)
+        std::vector<SharedRawObserver> shared_raw_;  //!< Ref-counted raw parser message observers (all streams)
+        std::unordered_set<std::string> disabled_;   //!< Runtime-disabled messages (see SetMessageEnabled())
+    };
+    std::shared_ptr<const ObserverSet> observers_ = std::make_shared<ObserverSet>();  //!< Current observer set
+    std::mutex observers_mutex_;  //!< Serialises observer set updates (readers do not take it)
+    //! Applies modify to a copy of the current observer set and atomically publishes the copy
+    void UpdateObserverSet(const std::function<void(ObserverSet&)>& modify);
+    //! Whether a message (name resp. NMEA formatter) is runtime-disabled (see SetMessageEnabled())
+    static bool MsgDisabled(const ObserverSet& set, const char* name);
+    BufferPool buffer_pool_;  //!< Pool of recycled message data buffers
+    //! Notify the observers of a stream for one message
+    void DispatchMsg(const ObserverSet& set, const std::size_t stream, const fpsdk::common::parser::ParserMsg& msg);
+    //! Notify FP_A message observers
+    void NotifyFpaObservers(const ObserverSet& set, const std::size_t stream,
+                            const fpsdk::common::parser::ParserMsg& msg);
+    //! Notify NMEA message observers
+    void NotifyNmeaObservers(const ObserverSet& set, const std::size_t stream,
+                             const fpsdk::common::parser::ParserMsg& msg);
+    //! Notify NOV_B message observers
+    void NotifyNovbObservers(const ObserverSet& set, const std::size_t stream,
+                             const fpsdk::common::parser::ParserMsg& msg);
+    //! Notify raw message observers
+    void NotifyRawObservers(const ObserverSet& set, const std::size_t stream,
+                            const fpsdk::common::parser::ParserMsg& msg);
 };
 
 /* ****************************************************************************************************************** */
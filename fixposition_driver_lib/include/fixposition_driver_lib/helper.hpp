@@ -51,13 +51,27 @@ static constexpr const char* GNSS2_FRAME_ID = "GNSS2";
 
 static constexpr const char* ENU_FRAME_ID = "FP_ENU";
 
+/**
+ * @brief Intern a frame ID string
+ *
+ * Returns a pointer to a canonical copy of the string in static storage, valid for the lifetime of the program. The
+ * driver only ever deals with a small, fixed set of frame IDs, so interning them once means the data structs below
+ * can store a plain pointer and the steady-state pose path (FP_A-ODOMETRY, FP_A-TF, ... to ROS message header) does
+ * no per-message string allocations.
+ *
+ * @param[in]  frame_id  The frame ID, e.g. "FP_POI"
+ *
+ * @returns the canonical copy of the frame ID
+ */
+const char* InternFrameId(const char* frame_id);
+
 fpsdk::common::time::Time FpaGpsTimeToTime(const fpsdk::common::parser::fpa::FpaGpsTime gps_time);
 
 struct TfData {
     bool valid = false;
     fpsdk::common::time::Time stamp;
-    std::string frame_id;
-    std::string child_frame_id;
+    const char* frame_id = "";        //!< Interned frame ID (see InternFrameId())
+    const char* child_frame_id = "";  //!< Interned frame ID (see InternFrameId())
     Eigen::Vector3d translation;
     Eigen::Quaterniond rotation;
     TfData() {
@@ -98,8 +112,8 @@ struct OdometryData {
     enum class Type { UNSPECIFIED, ODOMETRY, ODOMENU, ODOMSH };
     Type type = Type::UNSPECIFIED;
     fpsdk::common::time::Time stamp;
-    std::string frame_id;
-    std::string child_frame_id;
+    const char* frame_id = "";        //!< Interned frame ID (see InternFrameId())
+    const char* child_frame_id = "";  //!< Interned frame ID (see InternFrameId())
     PoseWithCovData pose;
     TwistWithCovData twist;
     bool SetFromFpaOdomPayload(const fpsdk::common::parser::fpa::FpaOdomPayload& payload);
@@ -165,22 +179,47 @@ inline Eigen::Matrix<double, 6, 6> BuildCovMat6D(const double xx, const double y
     return cov;
 }
 
+/**
+ * @brief Detector for jumps in the estimated position (movement larger than the estimated covariance)
+ *
+ * Check() runs on every FP_A-ODOMETRY message, so the detector is fixed-size and allocation-free: the covariance is
+ * always 3x3, and the warning message is formatted into a fixed buffer instead of a per-event std::string
+ */
 struct JumpDetector {
     JumpDetector();
     bool Check(const OdometryData& odometry_data);
 
+    //! Jump statistics, for a cheap diagnostics summary
+    struct Stats {
+        uint32_t count_ = 0;                     //!< Number of jumps detected
+        double max_displacement_ = 0.0;          //!< Largest per-axis position difference [m] of any jump
+        fpsdk::common::time::Time first_stamp_;  //!< Stamp of the first jump
+        fpsdk::common::time::Time last_stamp_;   //!< Stamp of the last (most recent) jump
+    };
+
     Eigen::Vector3d curr_pos_;
-    Eigen::MatrixXd curr_cov_;
+    Eigen::Matrix3d curr_cov_;
     fpsdk::common::time::Time curr_stamp_;
     Eigen::Vector3d prev_pos_;
-    Eigen::MatrixXd prev_cov_;
+    Eigen::Matrix3d prev_cov_;
     fpsdk::common::time::Time prev_stamp_;
     Eigen::Vector3d pos_diff_;
-    std::string warning_;
+    char warning_[256];  //!< Warning message, valid after Check() returned true
+    Stats stats_;        //!< Jump statistics
 };
 
+/**
+ * @brief Resolve a wheelspeed sensor location string to the corresponding FP_B-MEASUREMENTS enum
+ *
+ * @param[in]  location  The location string ("RC", "FR", "FL", "RR" or "RL")
+ *
+ * @returns the corresponding enum value, UNSPECIFIED for anything else
+ */
+fpsdk::common::parser::fpb::FpbMeasurementsMeasLoc WheelspeedLocation(const char* location);
+
 struct WheelSpeedData {
-    std::string location_;
+    fpsdk::common::parser::fpb::FpbMeasurementsMeasLoc location_ =
+        fpsdk::common::parser::fpb::FpbMeasurementsMeasLoc::UNSPECIFIED;
     bool vx_valid_ = false;
     int32_t vx_ = 0;
     bool vy_valid_ = false;
@@ -189,25 +228,27 @@ struct WheelSpeedData {
     int32_t vz_ = 0;
 };
 
+// The converters below fill a caller-provided vector instead of returning a fresh one, so that a (per-subscriber)
+// scratch vector can be reused across callbacks and the (up to) 100 Hz wheelspeed input path does not allocate
+
 template <typename RosMsgT>  // e.g. fixposition_driver_msgs::Speed
-inline std::vector<WheelSpeedData> SpeedMsgToWheelspeedData(const RosMsgT& msg) {
-    std::vector<WheelSpeedData> data;
+inline void SpeedMsgToWheelspeedData(const RosMsgT& msg, std::vector<WheelSpeedData>& data) {
+    data.clear();
     for (const auto& sensor : msg.sensors) {
-        data.push_back(
-            {sensor.location, sensor.vx_valid, sensor.vx, sensor.vy_valid, sensor.vy, sensor.vz_valid, sensor.vz});
+        data.push_back({WheelspeedLocation(sensor.location.c_str()), sensor.vx_valid, sensor.vx, sensor.vy_valid,
+                        sensor.vy, sensor.vz_valid, sensor.vz});
     }
-    return data;
 }
 
 template <typename RosMsgVector3T>
-std::vector<WheelSpeedData> Vector3MsgToWheelspeedData(const RosMsgVector3T& linear_msg, const DriverParams& params_) {
-    std::vector<WheelSpeedData> data;
+void Vector3MsgToWheelspeedData(const RosMsgVector3T& linear_msg, const DriverParams& params_,
+                                std::vector<WheelSpeedData>& data) {
+    data.clear();
     data.push_back(
-        {"RC", params_.converter_use_x_,
+        {fpsdk::common::parser::fpb::FpbMeasurementsMeasLoc::RC, params_.converter_use_x_,
          static_cast<int32_t>(std::round(linear_msg.x * params_.converter_scale_factor_)), params_.converter_use_y_,
          static_cast<int32_t>(std::round(linear_msg.y * params_.converter_scale_factor_)), params_.converter_use_z_,
          static_cast<int32_t>(std::round(linear_msg.z * params_.converter_scale_factor_))});
-    return data;
 }
 
 struct NmeaEpochData {
@@ -227,7 +268,7 @@ struct NmeaEpochData {
 
     // "Best of" data, populated by Complete(), NmeaEpoch.msg for docu
     fpsdk::common::time::Time stamp_;
-    std::string frame_id_;
+    const char* frame_id_ = "";  //!< Interned frame ID (see InternFrameId())
     fpsdk::common::parser::nmea::NmeaDate date_;
     fpsdk::common::parser::nmea::NmeaTime time_;
     fpsdk::common::parser::nmea::NmeaStatusGllRmc status_ = fpsdk::common::parser::nmea::NmeaStatusGllRmc::UNSPECIFIED;
@@ -264,8 +305,30 @@ struct NmeaEpochData {
 
     Eigen::Matrix<double, 3, 3> cov_enu_;
 
-    // Completes the data and returns it, and resets the instance back to empty
-    NmeaEpochData CompleteAndReset();
+    // Completes the data, i.e. populates the "best of" fields above from the collected messages
+    void Complete();
+    // Resets the instance back to empty (keeping the configured epoch)
+    void Reset();
+};
+
+/**
+ * @brief Double-buffered NMEA epoch data collector
+ *
+ * Messages for the current epoch are collected into the active buffer (Active()). At the end of the epoch
+ * CompleteAndSwap() completes and retires the active buffer and activates the other (reset) buffer for the next
+ * epoch. No payloads are copied: the retired buffer is returned by reference and remains valid until the next
+ * CompleteAndSwap() call.
+ */
+struct NmeaEpochCollector {
+    NmeaEpochCollector(const fpsdk::common::parser::fpa::FpaEpoch epoch);
+
+    //! The buffer collecting the current epoch
+    NmeaEpochData& Active() { return buffers_[active_]; }
+    //! Completes and retires the active buffer, activates the other one, and returns the retired buffer
+    const NmeaEpochData& CompleteAndSwap();
+
+    NmeaEpochData buffers_[2];  //!< Double buffer
+    int active_ = 0;            //!< Index of the active buffer
 };
 
 // Fusion epoch data, see FusionEpoch.msg for docu
@@ -301,8 +364,25 @@ struct FusionEpochData {
     fpsdk::common::parser::fpa::FpaImubiasPayload fpa_imubias_;
     void CollectFpaImubias(const fpsdk::common::parser::fpa::FpaImubiasPayload& payload);
 
-    // Completes the data and returns it, and sets up the instance for the next epoch
-    FusionEpochData CompleteAndReset(const fpsdk::common::parser::fpa::FpaEoePayload& eoe);
+    // Resets the instance back to empty
+    void Reset();
+};
+
+/**
+ * @brief Double-buffered fusion epoch data collector
+ *
+ * Same scheme as NmeaEpochCollector: messages are collected into the active buffer (Active()), CompleteAndSwap()
+ * retires it on FP_A-EOE and activates the other (reset) buffer, carrying over the slowly updating imubias data.
+ * The retired buffer is returned by reference and remains valid until the next CompleteAndSwap() call.
+ */
+struct FusionEpochCollector {
+    //! The buffer collecting the current epoch
+    FusionEpochData& Active() { return buffers_[active_]; }
+    //! Completes and retires the active buffer, activates the other one, and returns the retired buffer
+    const FusionEpochData& CompleteAndSwap(const fpsdk::common::parser::fpa::FpaEoePayload& eoe);
+
+    FusionEpochData buffers_[2];  //!< Double buffer
+    int active_ = 0;              //!< Index of the active buffer
 };
 
 void HelloWorld();
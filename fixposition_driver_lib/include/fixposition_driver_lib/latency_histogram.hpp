@@ -0,0 +1,119 @@
+/**
+ * \verbatim
+ * ___    ___
+ * \  \  /  /
+ *  \  \/  /   Copyright (c) Fixposition AG (www.fixposition.com) and contributors
+ *  /  /\  \   License: see the LICENSE file
+ * /__/  \__\
+ * \endverbatim
+ *
+ * @file
+ * @brief Lock-free latency histogram
+ */
+
+#ifndef __FIXPOSITION_DRIVER_LIB_LATENCY_HISTOGRAM_HPP__
+#define __FIXPOSITION_DRIVER_LIB_LATENCY_HISTOGRAM_HPP__
+
+/* LIBC/STL */
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+/* EXTERNAL */
+
+/* PACKAGE */
+
+namespace fixposition {
+/* ****************************************************************************************************************** */
+
+/**
+ * @brief Lock-free latency histogram (HDR style, with logarithmic buckets)
+ *
+ * Record() is wait-free (a relaxed counter increment plus a max update), so it can be called from the hot receive and
+ * dispatch paths. GetStats() derives the sample count and approximate percentiles from the bucket counts; since
+ * bucket ix covers [ 2^ix, 2^(ix+1) ) microseconds, a percentile is reported as the upper bound of its bucket, i.e.
+ * with at most a factor two of overestimation.
+ */
+class LatencyHistogram {
+   public:
+    static constexpr std::size_t NUM_BUCKETS = 32;  //!< Number of buckets, the last one takes all larger samples
+
+    /**
+     * @brief Record a latency sample
+     *
+     * @param[in]  nanos  The measured latency [ns]
+     */
+    void Record(const uint64_t nanos) {
+        const uint64_t micros = nanos / 1000;
+        std::size_t ix = (micros == 0 ? 0 : (std::size_t)(63 - __builtin_clzll(micros)));
+        if (ix >= NUM_BUCKETS) {
+            ix = NUM_BUCKETS - 1;
+        }
+        buckets_[ix].fetch_add(1, std::memory_order_relaxed);
+        uint64_t max = max_nanos_.load(std::memory_order_relaxed);
+        while ((nanos > max) && !max_nanos_.compare_exchange_weak(max, nanos, std::memory_order_relaxed)) {
+        }
+    }
+
+    /**
+     * @brief Histogram statistics
+     */
+    struct Stats {
+        uint64_t count_ = 0;  //!< Number of recorded samples
+        double p50_ = 0.0;    //!< Median latency [us] (approximate, see class docu)
+        double p99_ = 0.0;    //!< 99th percentile latency [us] (approximate, see class docu)
+        double max_ = 0.0;    //!< Maximum latency [us] (exact)
+    };
+
+    /**
+     * @brief Get the histogram statistics
+     *
+     * @returns the current statistics
+     */
+    Stats GetStats() const {
+        Stats stats;
+        std::array<uint64_t, NUM_BUCKETS> buckets;
+        for (std::size_t ix = 0; ix < NUM_BUCKETS; ix++) {
+            buckets[ix] = buckets_[ix].load(std::memory_order_relaxed);
+            stats.count_ += buckets[ix];
+        }
+        stats.p50_ = Percentile(buckets, stats.count_, 0.50);
+        stats.p99_ = Percentile(buckets, stats.count_, 0.99);
+        stats.max_ = (double)max_nanos_.load(std::memory_order_relaxed) * 1e-3;
+        return stats;
+    }
+
+    /**
+     * @brief Reset the histogram
+     */
+    void Reset() {
+        for (auto& bucket : buckets_) {
+            bucket.store(0, std::memory_order_relaxed);
+        }
+        max_nanos_.store(0, std::memory_order_relaxed);
+    }
+
+   private:
+    std::array<std::atomic<uint64_t>, NUM_BUCKETS> buckets_{};  //!< Bucket counts
+    std::atomic<uint64_t> max_nanos_{0};                        //!< Largest sample [ns]
+
+    //! The (approximate, upper bucket bound) latency [us] at quantile q
+    static double Percentile(const std::array<uint64_t, NUM_BUCKETS>& buckets, const uint64_t count, const double q) {
+        if (count == 0) {
+            return 0.0;
+        }
+        const uint64_t rank = (uint64_t)((double)(count - 1) * q) + 1;
+        uint64_t cum = 0;
+        for (std::size_t ix = 0; ix < NUM_BUCKETS; ix++) {
+            cum += buckets[ix];
+            if (cum >= rank) {
+                return (double)((uint64_t)1 << (ix + 1));
+            }
+        }
+        return 0.0;
+    }
+};
+
+/* ****************************************************************************************************************** */
+}  // namespace fixposition
+#endif  // __FIXPOSITION_DRIVER_LIB_LATENCY_HISTOGRAM_HPP__
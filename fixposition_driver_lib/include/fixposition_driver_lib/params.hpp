@@ -33,14 +33,27 @@ namespace fixposition {
  */
 struct DriverParams {
     std::string stream_;
+    std::vector<std::string> extra_streams_;
     double reconnect_delay_ = 5.0;
+    double reconnect_delay_max_ = 30.0;
     double delay_warning_ = 0.01;
     std::vector<std::string> messages_;
+    std::vector<std::string> decimation_;
     fpsdk::common::parser::fpa::FpaEpoch nmea_epoch_ = fpsdk::common::parser::fpa::FpaEpoch::UNSPECIFIED;
     bool fusion_epoch_ = true;
+    bool epoch_batching_ = false;
     bool raw_output_ = false;
+    std::string raw_record_path_;
+    int raw_record_size_mb_ = 100;
+    std::string shm_output_;
     bool cov_warning_ = false;
     bool nav2_mode_ = false;
+    double tf_epsilon_trans_ = 0.0;
+    double tf_epsilon_rot_ = 0.0;
+    double tf_max_rate_ = 0.0;
+    std::string thread_sched_;
+    int thread_prio_ = 0;
+    std::string thread_cpus_;
 
     enum class VelTopicType { UNSPECIFIED, TWIST, TWISTWITHCOV, ODOMETRY };
     bool converter_enabled_ = false;
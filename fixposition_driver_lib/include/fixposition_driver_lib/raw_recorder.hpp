@@ -0,0 +1,107 @@
+/**
+ * \verbatim
+ * ___    ___
+ * \  \  /  /
+ *  \  \/  /   Copyright (c) Fixposition AG (www.fixposition.com) and contributors
+ *  /  /\  \   License: see the LICENSE file
+ * /__/  \__\
+ * \endverbatim
+ *
+ * @file
+ * @brief Memory-mapped raw stream recorder
+ */
+
+#ifndef __FIXPOSITION_DRIVER_LIB_RAW_RECORDER_HPP__
+#define __FIXPOSITION_DRIVER_LIB_RAW_RECORDER_HPP__
+
+/* LIBC/STL */
+#include <cstdint>
+#include <string>
+
+/* EXTERNAL */
+
+/* PACKAGE */
+
+namespace fixposition {
+/* ****************************************************************************************************************** */
+
+/**
+ * @brief Memory-mapped raw stream recorder
+ *
+ * Records the raw sensor byte stream to disk for black-box style always-on capture. This is a much cheaper
+ * alternative to the raw_output topic: instead of copying every message into a ROS message, serialising it through
+ * the middleware and having a bag recorder write it back out, the worker appends the bytes straight into a
+ * memory-mapped file and the kernel flushes the pages in the background -- no syscall per write and no middleware
+ * involvement.
+ *
+ * The recording rotates between two segment files (<path>.0 and <path>.1), each preallocated to the configured
+ * maximum size. When the active segment is full, it is truncated to its used size and recording switches to the
+ * other segment (overwriting it). So at any time between one and two segments worth of the most recent stream data
+ * is on disk. The segments contain the verbatim byte stream and can be fed to any parser (e.g. the fpsdk tools).
+ */
+class RawRecorder {
+   public:
+    /**
+     * @brief Constructor
+     *
+     * @param[in]  path      Recording path, the segment files are <path>.0 and <path>.1
+     * @param[in]  max_size  Maximum size of one segment file [bytes]
+     */
+    RawRecorder(const std::string& path, const std::size_t max_size);
+
+    /**
+     * @brief Destructor, closes the recording
+     */
+    ~RawRecorder();
+
+    /**
+     * @brief Open the recording (create and map the first segment)
+     *
+     * @returns true on success, false otherwise
+     */
+    bool Open();
+
+    /**
+     * @brief Close the recording, truncating the active segment to its used size
+     */
+    void Close();
+
+    /**
+     * @brief Append raw data to the recording, rotating segments as needed
+     *
+     * @param[in]  data  The data
+     * @param[in]  size  Size of the data
+     */
+    void Record(const uint8_t* data, const std::size_t size);
+
+    /**
+     * @brief Statistics on the recording
+     */
+    struct Stats {
+        uint64_t num_bytes_ = 0;      //!< Total number of bytes recorded
+        uint64_t num_rotations_ = 0;  //!< Number of segment rotations
+    };
+
+    /**
+     * @brief Get statistics on the recording
+     *
+     * @returns a copy of the current recording statistics
+     */
+    Stats GetStats() const;
+
+   private:
+    const std::string path_;      //!< Recording path
+    const std::size_t max_size_;  //!< Maximum size of one segment file [bytes]
+    int seg_ix_ = 0;              //!< Active segment (0 or 1)
+    int fd_ = -1;                 //!< Active segment file descriptor
+    uint8_t* map_ = nullptr;      //!< Active segment mapping
+    std::size_t offset_ = 0;      //!< Write offset into the active segment
+    Stats stats_;                 //!< Recording statistics
+
+    bool OpenSegment();   //!< Create, preallocate and map the active segment
+    void CloseSegment();  //!< Unmap the active segment and truncate it to its used size
+};
+
+/* ****************************************************************************************************************** */
+}  // namespace fixposition
+#endif  // __FIXPOSITION_DRIVER_LIB_RAW_RECORDER_HPP__
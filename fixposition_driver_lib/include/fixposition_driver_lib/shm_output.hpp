@@ -0,0 +1,160 @@
+/**
+ * \verbatim
+ * ___    ___
+ * \  \  /  /
+ *  \  \/  /   Copyright (c) Fixposition AG (www.fixposition.com) and contributors
+ *  /  /\  \   License: see the LICENSE file
+ * /__/  \__\
+ * \endverbatim
+ *
+ * @file
+ * @brief Shared-memory output of the latest navigation state
+ */
+
+#ifndef __FIXPOSITION_DRIVER_LIB_SHM_OUTPUT_HPP__
+#define __FIXPOSITION_DRIVER_LIB_SHM_OUTPUT_HPP__
+
+/* LIBC/STL */
+#include <atomic>
+#include <cstdint>
+#include <string>
+
+/* EXTERNAL */
+#include <fpsdk_common/parser/fpa.hpp>
+
+/* PACKAGE */
+#include "fixposition_driver_lib/helper.hpp"
+
+namespace fixposition {
+/* ****************************************************************************************************************** */
+
+/**
+ * @brief Sequence-locked record in the shared-memory segment
+ *
+ * The counter is odd while an update is in progress and incremented by two per update. A reader must see the same
+ * even counter value before and after copying the payload for the copy to be consistent (see ShmReadRecord()).
+ */
+template <typename T>
+struct ShmRecord {
+    alignas(64) std::atomic<uint32_t> seq_;  //!< Sequence counter (the alignment keeps the records in separate
+                                             //!< cache lines, so updates do not false-share)
+    T data_;                                 //!< Payload, only consistent under the seqlock protocol
+};
+
+//! Latest odometry (from FP_A-ODOMETRY), all in ECEF
+struct ShmOdometry {
+    uint64_t stamp_ns_;           //!< Timestamp [ns]
+    double position_[3];          //!< Position [m]
+    double orientation_[4];       //!< Orientation quaternion (w, x, y, z)
+    double velocity_[3];          //!< Linear velocity [m/s] (in POI frame)
+    double angular_velocity_[3];  //!< Angular velocity [rad/s] (in POI frame)
+    uint32_t valid_;              //!< Data is valid (fusion initialised)
+    uint32_t reserved_;           //!< Padding, set to 0
+};
+
+//! Latest raw IMU sample (from FP_A-RAWIMU), in the IMU frame
+struct ShmImu {
+    uint64_t stamp_ns_;  //!< Timestamp [ns]
+    double acc_[3];      //!< Raw acceleration [m/s2]
+    double rot_[3];      //!< Raw angular velocity [rad/s]
+    uint32_t valid_;     //!< Data is valid
+    uint32_t reserved_;  //!< Padding, set to 0
+};
+
+//! Layout of the shared-memory segment. Readers should check magic_ and version_ before using the records.
+struct ShmLayout {
+    static constexpr uint32_t MAGIC = 0x46504e53;  //!< "FPNS" (Fixposition navigation state)
+    static constexpr uint32_t VERSION = 1;         //!< Layout version, bumped on incompatible changes
+    uint32_t magic_;                               //!< = MAGIC, written last when the segment is initialised
+    uint32_t version_;                             //!< = VERSION
+    ShmRecord<ShmOdometry> odometry_;              //!< Latest odometry
+    ShmRecord<ShmImu> imu_;                        //!< Latest raw IMU sample
+};
+
+/**
+ * @brief Read a sequence-locked record
+ *
+ * Lock-free and wait-free for the writer: the reader never blocks the driver, it merely retries (or keeps its
+ * previous copy) when an update happened to be in flight.
+ *
+ * @param[in]   record  The record to read
+ * @param[out]  data    The copied payload, only valid if true is returned
+ *
+ * @returns true if a consistent snapshot was copied, false if an update was in progress (just try again)
+ */
+template <typename T>
+inline bool ShmReadRecord(const ShmRecord<T>& record, T& data) {
+    const uint32_t seq = record.seq_.load(std::memory_order_acquire);
+    if ((seq & 1) != 0) {
+        return false;
+    }
+    data = record.data_;
+    std::atomic_thread_fence(std::memory_order_acquire);
+    return record.seq_.load(std::memory_order_relaxed) == seq;
+}
+
+/**
+ * @brief Shared-memory output of the latest pose and raw IMU sample
+ *
+ * Optional output backend for same-host consumers that cannot (or should not) link ROS, such as hard-real-time
+ * control processes: a small POSIX shared-memory segment (/dev/shm/<name>, see ShmLayout) holds the latest odometry
+ * and raw IMU sample, each behind a seqlock. The driver updates the records wait-free from the dispatch path (a
+ * plain struct copy and two counter stores per message, no syscalls and no locks), and any number of readers can
+ * poll the freshest state lock-free in nanoseconds. Readers only need this header (ShmLayout and ShmReadRecord()),
+ * no ROS and no link dependency on this library.
+ *
+ * Enabled via DriverParams::shm_output_ (the segment name). See FixpositionDriver::StartDriver() for the wiring.
+ */
+class ShmOutput {
+   public:
+    /**
+     * @brief Constructor
+     *
+     * @param[in]  name  Name of the shared-memory segment (with or without leading "/")
+     */
+    explicit ShmOutput(const std::string& name);
+
+    /**
+     * @brief Destructor, closes the segment (but does not unlink it, readers may still hold it)
+     */
+    ~ShmOutput();
+
+    /**
+     * @brief Create (or attach to) and initialise the segment
+     *
+     * @returns true on success, false otherwise (failures are logged)
+     */
+    bool Open();
+
+    /**
+     * @brief Close the segment
+     */
+    void Close();
+
+    /**
+     * @brief Update the odometry record (wait-free)
+     *
+     * @param[in]  data  The odometry data
+     */
+    void UpdateOdometry(const OdometryData& data);
+
+    /**
+     * @brief Update the raw IMU record (wait-free)
+     *
+     * @param[in]  payload  The FP_A-RAWIMU payload
+     */
+    void UpdateImu(const fpsdk::common::parser::fpa::FpaRawimuPayload& payload);
+
+   private:
+    //! Seqlock write side (see ShmReadRecord() for the reader protocol)
+    template <typename T>
+    void WriteRecord(ShmRecord<T>& record, const T& data);
+
+    std::string name_;             //!< Segment name (with leading "/")
+    int fd_ = -1;                  //!< Segment file descriptor (-1 = not open)
+    ShmLayout* layout_ = nullptr;  //!< Mapped segment (nullptr = not open)
+};
+
+/* ****************************************************************************************************************** */
+}  // namespace fixposition
+#endif  // __FIXPOSITION_DRIVER_LIB_SHM_OUTPUT_HPP__
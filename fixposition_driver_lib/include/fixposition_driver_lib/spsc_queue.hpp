@@ -0,0 +1,176 @@
+/**
+ * \verbatim
+ * ___    ___
+ * \  \  /  /
+ *  \  \/  /   Copyright (c) Fixposition AG (www.fixposition.com) and contributors
+ *  /  /\  \   License: see the LICENSE file
+ * /__/  \__\
+ * \endverbatim
+ *
+ * @file
+ * @brief Bounded single-producer/single-consumer queue
+ */
+
+#ifndef __FIXPOSITION_DRIVER_LIB_SPSC_QUEUE_HPP__
+#define __FIXPOSITION_DRIVER_LIB_SPSC_QUEUE_HPP__
+
+/* LIBC/STL */
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+/* EXTERNAL */
+
+/* PACKAGE */
+
+namespace fixposition {
+/* ****************************************************************************************************************** */
+
+/**
+ * @brief Bounded single-producer/single-consumer queue
+ *
+ * A fixed-capacity ring buffer for handing messages from the parsing (worker) thread to the dispatch thread. The
+ * Push() and Pop() fast paths are lock-free. When the queue is full, Push() drops the *oldest* element, so that a
+ * stalled consumer (e.g. a blocking middleware publish) delays, but never blocks, the producer, and the freshest
+ * data survives. The consumer can block on Wait() when the queue is empty; the mutex and condition variable are
+ * only used for this (slow) path.
+ *
+ * Each slot carries its own sequence counter (Vyukov-style bounded queue): a slot is only written after the consumer
+ * published it as free, and only read after the producer published it as filled. This is what makes the drop-oldest
+ * slot reuse safe -- the producer can lap the ring while the consumer is still moving an element out of a slot, and
+ * will not touch that slot until the move is done. head_ and tail_ are absolute (free-running) positions, the slot
+ * index is position modulo capacity.
+ *
+ * Statistics (high watermark, number of dropped elements) are kept so that queue depth can be monitored under load.
+ */
+template <typename T>
+class SpscQueue {
+   public:
+    /**
+     * @brief Constructor
+     *
+     * @param[in]  capacity  Maximum number of queued elements
+     */
+    explicit SpscQueue(const std::size_t capacity) : slots_(capacity) {
+        for (std::size_t ix = 0; ix < slots_.size(); ix++) {
+            slots_[ix].seq_.store(ix, std::memory_order_relaxed);
+        }
+    }
+
+    /**
+     * @brief Add element to the queue (producer side), dropping the oldest element if the queue is full
+     *
+     * @param[in]  elem  The element, consumed (moved-from) on return
+     */
+    void Push(T&& elem) {
+        while (true) {
+            const std::size_t pos = head_.load(std::memory_order_relaxed);
+            Slot& slot = slots_[pos % slots_.size()];
+            // The slot is free once its sequence counter equals the position (set by the consumer one lap earlier,
+            // see Pop()). Single producer, so head_ needs no CAS.
+            if (slot.seq_.load(std::memory_order_acquire) == pos) {
+                head_.store(pos + 1, std::memory_order_relaxed);
+                slot.elem_ = std::move(elem);
+                slot.seq_.store(pos + 1, std::memory_order_release);
+                break;
+            }
+            // Queue full: drop the oldest element by dequeuing and discarding it. Pop() can briefly fail here when
+            // the only unreleased slot is the one the consumer is just moving out of; retrying then simply waits
+            // out that move.
+            T dropped;
+            if (Pop(dropped)) {
+                num_dropped_.fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+        // Update high watermark and wake a waiting consumer
+        const std::size_t depth = Depth();
+        std::size_t hwm = high_watermark_.load(std::memory_order_relaxed);
+        while ((depth > hwm) && !high_watermark_.compare_exchange_weak(hwm, depth, std::memory_order_relaxed)) {
+        }
+        cond_.notify_one();
+    }
+
+    /**
+     * @brief Get element from the queue (consumer side, also used by the producer to drop the oldest element)
+     *
+     * @param[out]  elem  The element
+     *
+     * @returns true if an element was available, false if the queue was empty
+     */
+    bool Pop(T& elem) {
+        while (true) {
+            std::size_t pos = tail_.load(std::memory_order_relaxed);
+            Slot& slot = slots_[pos % slots_.size()];
+            const std::size_t seq = slot.seq_.load(std::memory_order_acquire);
+            // The slot is filled once its sequence counter is one past the position (see Push())
+            if (seq == pos) {
+                return false;  // Empty (or the producer is still filling this slot)
+            }
+            // The producer's drop-oldest path competes for this slot, so claim it before using it
+            if ((seq == (pos + 1)) && tail_.compare_exchange_strong(pos, pos + 1, std::memory_order_acq_rel)) {
+                elem = std::move(slot.elem_);
+                // Release the slot for the producer's next lap. Only this store makes the slot reusable, so the
+                // producer can never write into it while the move above is still in progress.
+                slot.seq_.store(pos + slots_.size(), std::memory_order_release);
+                return true;
+            }
+            // Someone else claimed the slot, reload and retry
+        }
+    }
+
+    /**
+     * @brief Wait for an element to become available (consumer side)
+     *
+     * @param[in]  millis  Maximum time to wait [ms]
+     *
+     * @returns true if the queue is (probably) non-empty, false if the wait timed out
+     */
+    bool Wait(const uint32_t millis) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        return cond_.wait_for(lock, std::chrono::milliseconds(millis),
+                              [this]() { return !Empty(); });
+    }
+
+    //! Queue currently empty?
+    bool Empty() const {
+        return tail_.load(std::memory_order_acquire) == head_.load(std::memory_order_acquire);
+    }
+
+    //! Current number of queued elements
+    std::size_t Depth() const {
+        const std::size_t head = head_.load(std::memory_order_acquire);
+        const std::size_t tail = tail_.load(std::memory_order_acquire);
+        const std::size_t depth = head - tail;  // Positions are free-running, wrap-safe unsigned arithmetic
+        return (depth <= slots_.size() ? depth : 0);
+    }
+
+    //! Highest number of queued elements seen so far
+    std::size_t HighWatermark() const { return high_watermark_.load(std::memory_order_relaxed); }
+
+    //! Number of elements dropped (oldest-first) because the queue was full
+    uint64_t NumDropped() const { return num_dropped_.load(std::memory_order_relaxed); }
+
+   private:
+    //! Queue slot: the element and the sequence counter that tracks whether the slot is free or filled (see Push()
+    //! resp. Pop() for the protocol)
+    struct Slot {
+        std::atomic<std::size_t> seq_;  //!< Sequence counter
+        T elem_;                        //!< The element
+    };
+
+    std::vector<Slot> slots_;                       //!< Element storage
+    std::atomic<std::size_t> head_{0};              //!< Producer (write) position (free-running)
+    std::atomic<std::size_t> tail_{0};              //!< Consumer (read) position (free-running)
+    std::atomic<std::size_t> high_watermark_{0};    //!< Highest queue depth seen
+    std::atomic<uint64_t> num_dropped_{0};          //!< Number of dropped elements
+    std::mutex mutex_;                              //!< For consumer Wait() only
+    std::condition_variable cond_;                  //!< For consumer Wait() only
+};
+
+/* ****************************************************************************************************************** */
+}  // namespace fixposition
+#endif  // __FIXPOSITION_DRIVER_LIB_SPSC_QUEUE_HPP__
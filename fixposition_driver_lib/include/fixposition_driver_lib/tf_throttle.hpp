@@ -0,0 +1,111 @@
+/**
+ * \verbatim
+ * ___    ___
+ * \  \  /  /
+ *  \  \/  /   Copyright (c) Fixposition AG (www.fixposition.com) and contributors
+ *  /  /\  \   License: see the LICENSE file
+ * /__/  \__\
+ * \endverbatim
+ *
+ * @file
+ * @brief TF output change detection and rate decimation
+ */
+
+#ifndef __FIXPOSITION_DRIVER_LIB_TF_THROTTLE_HPP__
+#define __FIXPOSITION_DRIVER_LIB_TF_THROTTLE_HPP__
+
+/* LIBC/STL */
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+/* EXTERNAL */
+#include <fpsdk_common/ext/eigen_core.hpp>
+#include <fpsdk_common/ext/eigen_geometry.hpp>
+
+/* PACKAGE */
+
+namespace fixposition {
+/* ****************************************************************************************************************** */
+
+/**
+ * @brief TF output change detection and rate decimation
+ *
+ * Gates the transforms the driver broadcasts to /tf. At full sensor rate the driver easily dominates the /tf
+ * bandwidth of the whole system, and static-ish transforms (e.g. FP_POI -> FP_IMUH) are re-broadcast although they
+ * never change. Before each send the caller asks Accept(), which suppresses the transform if it moved less than the
+ * configured epsilons since the last accepted send (change detection) resp. if it would exceed the configured maximum
+ * rate (decimation). Unchanged transforms are still re-accepted at a low keepalive rate so that downstream tf2
+ * buffers do not expire them. With all parameters at 0 every transform is accepted (the driver's original
+ * behaviour).
+ *
+ * Transforms are keyed by their (interned, see InternFrameId()) frame ID pair. Accept() must always be called from
+ * the same thread (the driver's dispatch thread); GetStats() can be called from any thread (the counters are relaxed
+ * atomics, like the other driver statistics).
+ */
+class TfThrottle {
+   public:
+    /**
+     * @brief Constructor
+     *
+     * @param[in]  epsilon_trans  Suppress if translation moved less than this [m] (0.0 = change detection off)
+     * @param[in]  epsilon_rot    Suppress if rotation moved less than this [rad] (0.0 = change detection off)
+     * @param[in]  max_rate       Maximum send rate per transform [Hz] (0.0 = no decimation)
+     */
+    TfThrottle(const double epsilon_trans, const double epsilon_rot, const double max_rate);
+
+    /**
+     * @brief Decide whether a transform should be sent
+     *
+     * @param[in]  frame_id        Interned frame ID
+     * @param[in]  child_frame_id  Interned child frame ID
+     * @param[in]  translation     The transform's translation
+     * @param[in]  rotation        The transform's rotation
+     *
+     * @returns true if the transform should be sent, false if it should be suppressed
+     */
+    bool Accept(const char* frame_id, const char* child_frame_id, const Eigen::Vector3d& translation,
+                const Eigen::Quaterniond& rotation);
+
+    /**
+     * @brief Statistics on the TF output gating
+     */
+    struct Stats {
+        uint64_t num_sent_ = 0;        //!< Number of accepted (sent) transforms
+        uint64_t num_suppressed_ = 0;  //!< Number of suppressed transforms
+    };
+
+    /**
+     * @brief Get statistics on the TF output gating
+     *
+     * @returns a copy of the current statistics
+     */
+    Stats GetStats() const;
+
+   private:
+    double epsilon_trans_ = 0.0;  //!< Change detection epsilon for the translation [m]
+    double epsilon_rot_ = 0.0;    //!< Change detection epsilon for the rotation [rad]
+    uint64_t interval_ns_ = 0;    //!< Minimum interval between sends [ns] (from the max rate)
+    bool enabled_ = false;        //!< Any gating configured at all?
+
+    //! Last accepted state per transform
+    struct Entry {
+        const char* frame_id_ = "";        //!< Interned frame ID
+        const char* child_frame_id_ = "";  //!< Interned child frame ID
+        Eigen::Vector3d translation_;      //!< Translation at the last accepted send
+        Eigen::Quaterniond rotation_;      //!< Rotation at the last accepted send
+        uint64_t last_ns_ = 0;             //!< Monotonic time of the last accepted send [ns]
+    };
+    std::vector<Entry> entries_;  //!< The known transforms (few, linear scan on interned pointers)
+    //! Statistics counters. Written by Accept() on the dispatch thread only, but read by GetStats() from any
+    //! thread, hence atomics (relaxed: monotonic counters, no ordering needed, same as ReadStatsCounters)
+    struct StatsCounters {
+        std::atomic<uint64_t> num_sent_{0};        //!< see Stats::num_sent_
+        std::atomic<uint64_t> num_suppressed_{0};  //!< see Stats::num_suppressed_
+    };
+    StatsCounters stats_;  //!< Statistics
+};
+
+/* ****************************************************************************************************************** */
+}  // namespace fixposition
+#endif  // __FIXPOSITION_DRIVER_LIB_TF_THROTTLE_HPP__
@@ -12,14 +12,27 @@
  */
 
 /* LIBC/STL */
+#include <algorithm>
+#include <array>
+#include <chrono>
 #include <cstdint>
+#include <cstdlib>
 #include <cstring>
 #include <functional>
+#include <memory>
 #include <stdexcept>
+#include <utility>
 
 /* EXTERNAL */
 #include <arpa/inet.h>
 #include <fcntl.h>
+#include <netinet/tcp.h>
+#include <poll.h>
+#include <pthread.h>
+#include <sched.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
 
 #include <fpsdk_common/logging.hpp>
 #include <fpsdk_common/parser/fpa.hpp>
@@ -36,11 +49,50 @@ namespace fixposition {
 using namespace fpsdk::common;
 using namespace fpsdk::common::parser;
 
+//! Capacity of the parse-to-dispatch message queue. At the highest sensor rates (FP_A-RAWIMU at 200 Hz plus NMEA and
+//! NOV_B) this buffers several seconds worth of messages before the drop-oldest policy kicks in.
+static constexpr std::size_t MSG_QUEUE_CAPACITY = 2048;
+
+//! Capacities of the TX queues. Wheelspeed messages are small and frequent, correction data is bulky and a backlog
+//! larger than a few seconds is stale anyway (the overflow policy drops the oldest queued message).
+static constexpr std::size_t TX_QUEUE_CAPACITY_SPEED = 32;
+static constexpr std::size_t TX_QUEUE_CAPACITY_CORR = 128;
+
+//! Timeout [ms] for a TCP connect. The initial connect (StartDriver()) and the extra streams wait this long at most,
+//! reconnects of the main stream pend in the event loop instead (see Reconnect())
+static constexpr int CONNECT_TIMEOUT = 10000;
+
+//! Monotonic timestamp [ns] for latency measurements
+static uint64_t NowNanos() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
 FixpositionDriver::FixpositionDriver(const DriverParams& params)
     : /* clang-format off */
-    params_   { params },
-    worker_   { "driver", std::bind(&FixpositionDriver::Worker, this, std::placeholders::_1) }  // clang-format on
-{}
+    params_       { params },
+    worker_       { "driver", std::bind(&FixpositionDriver::Worker, this, std::placeholders::_1) },
+    msg_queue_    { MSG_QUEUE_CAPACITY },
+    dispatch_     { "dispatch", std::bind(&FixpositionDriver::Dispatch, this, std::placeholders::_1) },
+    tx_worker_    { "tx", std::bind(&FixpositionDriver::TxWorker, this, std::placeholders::_1) },
+    tx_buffer_pool_ { TX_QUEUE_CAPACITY_SPEED },
+    buffer_pool_  { MSG_QUEUE_CAPACITY + 16 }  // clang-format on
+{
+    UpdateObserverSet(
+        [&params](ObserverSet& set) { set.streams_.resize(1 + params.extra_streams_.size()); });
+    for (const auto& spec : params_.extra_streams_) {
+        auto stream = std::make_unique<ExtraStream>();
+        stream->spec_ = spec;
+        extra_streams_.push_back(std::move(stream));
+    }
+    if (!params_.raw_record_path_.empty()) {
+        raw_recorder_ = std::make_unique<RawRecorder>(params_.raw_record_path_,
+                                                      (std::size_t)params_.raw_record_size_mb_ * 1024 * 1024);
+    }
+    if (!params_.shm_output_.empty()) {
+        shm_output_ = std::make_unique<ShmOutput>(params_.shm_output_);
+    }
+}
 
 FixpositionDriver::~FixpositionDriver() { StopDriver(); }
 
@@ -49,55 +101,256 @@ FixpositionDriver::~FixpositionDriver() { StopDriver(); }
 bool FixpositionDriver::Connect() {
     if (sensor_fd_ >= 0) {
         WARNING("Already connected to sensor");
+    }
+    // File replay: feed a recorded raw stream through the exact same parser and observer chain, at maximum speed
+    // (the raw byte stream carries no timestamps). The fd is a regular file and is not part of the epoll set (epoll
+    // does not work on regular files), see Read().
+    else if (string::StrStartsWith(params_.stream_, "file://")) {
+        INFO("Replaying %s", params_.stream_.c_str());
+        sensor_fd_ = OpenFile(params_.stream_, params_.stream_.substr(7));
+        serial_ = false;
+        file_ = (sensor_fd_ >= 0);
+    } else {
+        INFO("Connecting to %s", params_.stream_.c_str());
+        sensor_fd_ = OpenStream(params_.stream_, serial_, options_save_);
+    }
+
+    // Also bring up any extra input streams that are not (or no longer) connected
+    for (auto& stream : extra_streams_) {
+        if (stream->fd_ < 0) {
+            INFO("Connecting to %s", stream->spec_.c_str());
+            stream->fd_ = OpenStream(stream->spec_, stream->serial_, stream->options_save_);
+        }
+    }
+
+    return sensor_fd_ >= 0;
+}
+
+void FixpositionDriver::Disconnect() {
+    if (connect_fd_ >= 0) {
+        epoll_ctl(epoll_fd_, EPOLL_CTL_DEL, connect_fd_, NULL);
+        close(connect_fd_);
+        connect_fd_ = -1;
+    }
+    if (sensor_fd_ >= 0) {
+        INFO("Disconnecting from %s", params_.stream_.c_str());
+        CloseStream(sensor_fd_, serial_, options_save_);
+        sensor_fd_ = -1;
+    }
+    for (auto& stream : extra_streams_) {
+        if (stream->fd_ >= 0) {
+            INFO("Disconnecting from %s", stream->spec_.c_str());
+            CloseStream(stream->fd_, stream->serial_, stream->options_save_);
+            stream->fd_ = -1;
+        }
+    }
+}
+
+bool FixpositionDriver::IsConnected() const { return sensor_fd_ >= 0; }
+
+bool FixpositionDriver::Reconnect() {
+    // Wait for a pending non-blocking connect to complete, fail, or time out. The connect fd is registered for
+    // EPOLLOUT in the same epoll set that Read() uses, so a shutdown wakeup (wake_fd_) is seen immediately
+    if (connect_fd_ >= 0) {
+        std::array<struct epoll_event, 16> events;
+        const int res = epoll_wait(epoll_fd_, events.data(), events.size(), 337);
+        if (res < 0) {
+            if (errno != EINTR) {
+                WARNING("epoll_wait() fail: %s", string::StrError(errno).c_str());
+            }
+            return true;
+        }
+        for (int ix = 0; ix < res; ix++) {
+            const int fd = events[ix].data.fd;
+            // Shutdown wakeup (see StopDriver())
+            if (fd == wake_fd_) {
+                return false;
+            }
+            if (fd != connect_fd_) {
+                // Keep servicing the extra streams while the main stream is down, they would otherwise keep the
+                // event loop spinning (and their data would go stale)
+                for (std::size_t stream_ix = 0; stream_ix < extra_streams_.size(); stream_ix++) {
+                    if (extra_streams_[stream_ix]->fd_ == fd) {
+                        ReadExtraStream(stream_ix);
+                        break;
+                    }
+                }
+                continue;
+            }
+            int err = 0;
+            socklen_t err_size = sizeof(err);
+            if (getsockopt(connect_fd_, SOL_SOCKET, SO_ERROR, &err, &err_size) != 0) {
+                err = errno;
+            }
+            // Connect completed: the fd stays in the epoll set, but from now on we care about readability
+            if (((events[ix].events & (EPOLLERR | EPOLLHUP)) == 0) && (err == 0)) {
+                struct epoll_event event;
+                std::memset(&event, 0, sizeof(event));
+                event.events = EPOLLIN | EPOLLERR | EPOLLHUP;
+                event.data.fd = connect_fd_;
+                if (epoll_ctl(epoll_fd_, EPOLL_CTL_MOD, connect_fd_, &event) != 0) {
+                    WARNING("epoll_ctl() fail: %s", string::StrError(errno).c_str());
+                    close(connect_fd_);
+                    connect_fd_ = -1;
+                    ScheduleReconnect();
+                    return true;
+                }
+                INFO("Connected to %s", params_.stream_.c_str());
+                sensor_fd_ = connect_fd_;
+                connect_fd_ = -1;
+                serial_ = false;
+                connect_backoff_ = 0.0;
+                next_connect_ = 0;
+                // Also bring the extra streams back up
+                for (auto& stream : extra_streams_) {
+                    if (stream->fd_ < 0) {
+                        INFO("Connecting to %s", stream->spec_.c_str());
+                        stream->fd_ = OpenStream(stream->spec_, stream->serial_, stream->options_save_);
+                    }
+                }
+            }
+            // Connect failed
+            else {
+                WARNING("Failed connecting to %s: %s", params_.stream_.c_str(),
+                        string::StrError(err != 0 ? err : ECONNREFUSED).c_str());
+                epoll_ctl(epoll_fd_, EPOLL_CTL_DEL, connect_fd_, NULL);
+                close(connect_fd_);
+                connect_fd_ = -1;
+                ScheduleReconnect();
+            }
+            return true;
+        }
+        // Still pending, give up eventually
+        if ((connect_fd_ >= 0) && (NowNanos() >= connect_deadline_)) {
+            WARNING("Failed connecting to %s: timeout", params_.stream_.c_str());
+            epoll_ctl(epoll_fd_, EPOLL_CTL_DEL, connect_fd_, NULL);
+            close(connect_fd_);
+            connect_fd_ = -1;
+            ScheduleReconnect();
+        }
+        return true;
+    }
+
+    // Pace the attempts: backoff first (this also covers a freshly lost connection, where the backoff starts over
+    // at reconnect_delay_), sleeping in small slices so that a shutdown is not delayed
+    if (connect_backoff_ <= 0.0) {
+        ScheduleReconnect();
         return true;
     }
+    const uint64_t now = NowNanos();
+    if (now < next_connect_) {
+        return !worker_.Sleep(std::min<uint64_t>(((next_connect_ - now) / 1000000) + 1, 337));
+    }
 
+    // Start the next attempt. TCP connects asynchronously (completion handled above), everything else -- serial
+    // devices, file replay, bad specs -- through the blocking Connect(), which does not wait on a peer
     if (string::StrStartsWith(params_.stream_, "tcpcli://")) {
         const auto parts = string::StrSplit(params_.stream_.substr(9), ":");
         int port = 0;
         if ((parts.size() == 2) && !parts[0].empty() && !parts[1].empty() && string::StrToValue(parts[1], port)) {
-            serial_ = false;
             INFO("Connecting to %s", params_.stream_.c_str());
-            return ConnectTcp(parts[0], port);
+            connect_fd_ = StartTcpConnect(params_.stream_, parts[0], port);
+            if (connect_fd_ >= 0) {
+                struct epoll_event event;
+                std::memset(&event, 0, sizeof(event));
+                event.events = EPOLLOUT | EPOLLERR | EPOLLHUP;
+                event.data.fd = connect_fd_;
+                if (epoll_ctl(epoll_fd_, EPOLL_CTL_ADD, connect_fd_, &event) != 0) {
+                    WARNING("epoll_ctl() fail: %s", string::StrError(errno).c_str());
+                    close(connect_fd_);
+                    connect_fd_ = -1;
+                }
+            }
+            if (connect_fd_ >= 0) {
+                connect_deadline_ = NowNanos() + ((uint64_t)CONNECT_TIMEOUT * 1000000);
+            } else {
+                ScheduleReconnect();
+            }
+        } else {
+            WARNING("Bad stream spec: %s", params_.stream_.c_str());
+            ScheduleReconnect();
         }
-    } else if (string::StrStartsWith(params_.stream_, "serial://")) {
-        const auto parts = string::StrSplit(params_.stream_.substr(9), ":");
+    } else if (!Connect()) {
+        ScheduleReconnect();
+    }
+    return true;
+}
+
+void FixpositionDriver::ScheduleReconnect() {
+    connect_backoff_ = (connect_backoff_ <= 0.0
+                            ? params_.reconnect_delay_
+                            : std::min(connect_backoff_ * 2.0, params_.reconnect_delay_max_));
+    // Jitter of +/-20% so that multiple drivers (e.g. a fleet on one network) do not retry in lockstep
+    const double delay = connect_backoff_ * (0.8 + (0.4 * (double)std::rand() / (double)RAND_MAX));
+    INFO("Reconnecting in %.1f seconds...", delay);
+    next_connect_ = NowNanos() + (uint64_t)(delay * 1e9);
+}
+
+int FixpositionDriver::OpenStream(const std::string& spec, bool& serial, struct termios& options_save) {
+    if (string::StrStartsWith(spec, "tcpcli://")) {
+        const auto parts = string::StrSplit(spec.substr(9), ":");
+        int port = 0;
+        if ((parts.size() == 2) && !parts[0].empty() && !parts[1].empty() && string::StrToValue(parts[1], port)) {
+            serial = false;
+            return OpenTcp(spec, parts[0], port);
+        }
+    } else if (string::StrStartsWith(spec, "serial://")) {
+        const auto parts = string::StrSplit(spec.substr(9), ":");
         int baudrate = 0;
         if ((parts.size() == 2) && !parts[0].empty() && !parts[1].empty() && string::StrToValue(parts[1], baudrate)) {
-            serial_ = true;
-            INFO("Connecting to %s", params_.stream_.c_str());
-            return ConnectSerial(parts[0], baudrate);
+            serial = true;
+            return OpenSerial(spec, parts[0], baudrate, options_save);
         }
     }
 
-    WARNING("Bad stream spec: %s", params_.stream_.c_str());
-    return false;
+    WARNING("Bad stream spec: %s", spec.c_str());
+    return -1;
 }
 
-void FixpositionDriver::Disconnect() {
-    if (IsConnected()) {
-        INFO("Disconnecting from %s", params_.stream_.c_str());
-        if (serial_) {
-            DisconnectSerial();
-        } else {
-            DisconnectTcp();
-        }
-        sensor_fd_ = -1;
-        params_.stream_.clear();
+int FixpositionDriver::OpenFile(const std::string& spec, const std::string& path) {
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        WARNING("Failed opening %s: %s", spec.c_str(), string::StrError(errno).c_str());
+        return -1;
     }
+    return fd;
 }
 
-bool FixpositionDriver::IsConnected() const { return sensor_fd_ >= 0; }
+int FixpositionDriver::OpenTcp(const std::string& spec, const std::string& ip, const int port) {
+    const int fd = StartTcpConnect(spec, ip, port);
+    if (fd < 0) {
+        return -1;
+    }
+    if (!FinishTcpConnect(spec, fd, CONNECT_TIMEOUT)) {
+        return -1;
+    }
+    if (!AddReadFdToEvents(fd)) {
+        close(fd);
+        return -1;
+    }
 
-bool FixpositionDriver::ConnectTcp(const std::string& ip, const int port) {
-    DisconnectTcp();
+    INFO("Connected to %s", spec.c_str());
+    return fd;
+}
 
+int FixpositionDriver::StartTcpConnect(const std::string& spec, const std::string& ip, const int port) {
     int fd = socket(AF_INET, SOCK_STREAM, 0);
     if (fd < 0) {
-        WARNING("Failed connecting to %s: %s", params_.stream_.c_str(), string::StrError(errno).c_str());
-        return false;
+        WARNING("Failed connecting to %s: %s", spec.c_str(), string::StrError(errno).c_str());
+        return -1;
+    }
+
+    // Non-blocking connect: the call only initiates the TCP handshake, completion is signalled by the socket
+    // becoming writable (FinishTcpConnect() resp. the reconnect state machine, see Reconnect())
+    const int flags = fcntl(fd, F_GETFL, 0);
+    if ((flags < 0) || (fcntl(fd, F_SETFL, flags | O_NONBLOCK) != 0)) {
+        WARNING("Failed connecting to %s: %s", spec.c_str(), string::StrError(errno).c_str());
+        close(fd);
+        return -1;
     }
 
+    SetupTcpAliveness(spec, fd);
+
     struct sockaddr_in server_address;
     server_address.sin_family = AF_INET;
     server_address.sin_addr.s_addr = INADDR_ANY;
@@ -105,23 +358,52 @@ bool FixpositionDriver::ConnectTcp(const std::string& ip, const int port) {
     server_address.sin_port = htons(port);
 
     const int res = connect(fd, (struct sockaddr*)&server_address, sizeof server_address);
-
-    if (res != 0) {
-        WARNING("Failed connecting to %s: %s", params_.stream_.c_str(), string::StrError(errno).c_str());
-        return false;
+    if ((res != 0) && (errno != EINPROGRESS)) {
+        WARNING("Failed connecting to %s: %s", spec.c_str(), string::StrError(errno).c_str());
+        close(fd);
+        return -1;
     }
 
-    INFO("Connected to %s", params_.stream_.c_str());
-    sensor_fd_ = fd;
-    poll_fds_[0].fd = fd;
-    poll_fds_[0].events = POLLIN | POLLERR | POLLHUP;
-    return true;
+    return fd;
 }
 
-void FixpositionDriver::DisconnectTcp() {
-    if (sensor_fd_ >= 0) {
-        close(sensor_fd_);
+bool FixpositionDriver::FinishTcpConnect(const std::string& spec, const int fd, const int timeout) {
+    struct pollfd pfd;
+    std::memset(&pfd, 0, sizeof(pfd));
+    pfd.fd = fd;
+    pfd.events = POLLOUT;
+    const int res = poll(&pfd, 1, timeout);
+    int err = 0;
+    socklen_t err_size = sizeof(err);
+    if ((res > 0) && (getsockopt(fd, SOL_SOCKET, SO_ERROR, &err, &err_size) == 0) && (err == 0)) {
+        return true;
     }
+    WARNING("Failed connecting to %s: %s", spec.c_str(),
+            (res == 0 ? "timeout" : string::StrError(err != 0 ? err : errno).c_str()));
+    close(fd);
+    return false;
+}
+
+void FixpositionDriver::SetupTcpAliveness(const std::string& spec, const int fd) {
+    // Detect dead links (cable pulled, sensor power-cycled) within a few seconds instead of waiting for a FIN/RST
+    // that may never come: probe an idle connection after one second, once per second, give up after three missed
+    // probes, and cap how long unacknowledged TX data may linger. All best effort, the stream works without.
+    int keepalive = 1;
+    int idle = 1;
+    int interval = 1;
+    int count = 3;
+    if ((setsockopt(fd, SOL_SOCKET, SO_KEEPALIVE, &keepalive, sizeof(keepalive)) != 0) ||
+        (setsockopt(fd, IPPROTO_TCP, TCP_KEEPIDLE, &idle, sizeof(idle)) != 0) ||
+        (setsockopt(fd, IPPROTO_TCP, TCP_KEEPINTVL, &interval, sizeof(interval)) != 0) ||
+        (setsockopt(fd, IPPROTO_TCP, TCP_KEEPCNT, &count, sizeof(count)) != 0)) {
+        WARNING("Failed enabling TCP keepalive on %s: %s", spec.c_str(), string::StrError(errno).c_str());
+    }
+#ifdef TCP_USER_TIMEOUT
+    unsigned int user_timeout = 5000;  // [ms]
+    if (setsockopt(fd, IPPROTO_TCP, TCP_USER_TIMEOUT, &user_timeout, sizeof(user_timeout)) != 0) {
+        WARNING("Failed setting TCP user timeout on %s: %s", spec.c_str(), string::StrError(errno).c_str());
+    }
+#endif
 }
 
 #ifndef B460800
@@ -134,7 +416,8 @@ void FixpositionDriver::DisconnectTcp() {
 #define B921600 921600
 #endif
 
-bool FixpositionDriver::ConnectSerial(const std::string& dev, const int baud) {
+int FixpositionDriver::OpenSerial(const std::string& spec, const std::string& dev, const int baud,
+                                  struct termios& options_save) {
     speed_t speed;
     switch (baud) {  // clang-format off
         case   9600: speed = B9600;    break;
@@ -147,22 +430,20 @@ bool FixpositionDriver::ConnectSerial(const std::string& dev, const int baud) {
         case 921600: speed = B921600;  break;  // clang-format on
         default:
             WARNING("Unsupported baudrate %d", baud);
-            return false;
+            return -1;
     }
 
-    DisconnectSerial();
-
     int fd = open(dev.c_str(), O_RDWR | O_NOCTTY);
 
     if (fd == -1) {
-        WARNING("Failed connecting to %s: %s", params_.stream_.c_str(), string::StrError(errno).c_str());
-        return false;
+        WARNING("Failed connecting to %s: %s", spec.c_str(), string::StrError(errno).c_str());
+        return -1;
     }
 
     // Get current serial port options:
     struct termios options;
     tcgetattr(fd, &options);
-    options_save_ = options;
+    options_save = options;
 
     char speed_buf[10];
     snprintf(speed_buf, sizeof(speed_buf), "0%06o", (int)cfgetispeed(&options));
@@ -171,63 +452,181 @@ bool FixpositionDriver::ConnectSerial(const std::string& dev, const int baud) {
     options.c_oflag &= ~(OPOST | ONLCR);
     options.c_lflag &= ~(ISIG | ICANON | ECHO | ECHOE | ECHOK | ECHOCTL | ECHOKE | IEXTEN);
     options.c_cc[VEOL] = 0;
+    // Fully non-blocking reads: the event loop (epoll) signals readability, so read()/recv() must never wait itself
     options.c_cc[VMIN] = 0;
-    options.c_cc[VTIME] = 50;
+    options.c_cc[VTIME] = 0;
 
     cfsetospeed(&options, speed); /* baud rate */
     tcsetattr(fd, TCSANOW, &options);
 
-    INFO("Connected to %s", params_.stream_.c_str());
-    sensor_fd_ = fd;
-    poll_fds_[0].fd = fd;
-    poll_fds_[0].events = POLLIN | POLLERR | POLLHUP;
-    return true;
+    if (!AddReadFdToEvents(fd)) {
+        tcsetattr(fd, TCSANOW, &options_save);
+        close(fd);
+        return -1;
+    }
+
+    INFO("Connected to %s", spec.c_str());
+    return fd;
 }
 
-void FixpositionDriver::DisconnectSerial() {
-    if (sensor_fd_ >= 0) {
-        tcsetattr(sensor_fd_, TCSANOW, &options_save_);
-        close(sensor_fd_);
+void FixpositionDriver::CloseStream(const int fd, const bool serial, const struct termios& options_save) {
+    if (fd >= 0) {
+        if (serial) {
+            tcsetattr(fd, TCSANOW, &options_save);
+        }
+        close(fd);
+    }
+}
+
+bool FixpositionDriver::SetupEvents() {
+    TeardownEvents();
+
+    epoll_fd_ = epoll_create1(0);
+    if (epoll_fd_ < 0) {
+        WARNING("epoll_create1() fail: %s", string::StrError(errno).c_str());
+        return false;
+    }
+
+    wake_fd_ = eventfd(0, EFD_NONBLOCK);
+    if (wake_fd_ < 0) {
+        WARNING("eventfd() fail: %s", string::StrError(errno).c_str());
+        TeardownEvents();
+        return false;
+    }
+
+    return AddReadFdToEvents(wake_fd_);
+}
+
+void FixpositionDriver::TeardownEvents() {
+    if (wake_fd_ >= 0) {
+        close(wake_fd_);
+        wake_fd_ = -1;
+    }
+    if (epoll_fd_ >= 0) {
+        close(epoll_fd_);
+        epoll_fd_ = -1;
     }
 }
 
+bool FixpositionDriver::AddReadFdToEvents(const int fd) {
+    struct epoll_event event;
+    std::memset(&event, 0, sizeof(event));
+    event.events = EPOLLIN | EPOLLERR | EPOLLHUP;
+    event.data.fd = fd;
+    if (epoll_ctl(epoll_fd_, EPOLL_CTL_ADD, fd, &event) != 0) {
+        WARNING("epoll_ctl() fail: %s", string::StrError(errno).c_str());
+        return false;
+    }
+    return true;
+}
+
 std::size_t FixpositionDriver::Read(uint8_t* buf, const std::size_t size, const int timeout) {
     if (!IsConnected()) {
         WARNING_THR(1000, "no connection, cannot read");
         return 0;
     }
 
-    const int res = poll(poll_fds_.data(), poll_fds_.size(), timeout);
+    // File replay: reads from a regular file never block, so no event loop is involved and the stream is consumed
+    // flat-out at maximum speed. At EOF the replay ends cleanly (the worker stops instead of reconnecting).
+    if (file_) {
+        const ssize_t rv = read(sensor_fd_, buf, size);
+        if (rv > 0) {
+            read_stats_.num_reads_.fetch_add(1, std::memory_order_relaxed);
+            read_stats_.num_bytes_.fetch_add(rv, std::memory_order_relaxed);
+            if ((std::size_t)rv > read_stats_.max_read_.load(std::memory_order_relaxed)) {
+                read_stats_.max_read_.store(rv, std::memory_order_relaxed);  // Single writer, no CAS needed
+            }
+            return rv;
+        }
+        if (rv == 0) {
+            INFO("End of %s reached", params_.stream_.c_str());
+        } else {
+            WARNING("read fail: %s", string::StrError(errno).c_str());
+        }
+        replay_done_ = true;
+        Disconnect();
+        return 0;
+    }
+
+    std::array<struct epoll_event, 16> events;
+    const int res = epoll_wait(epoll_fd_, events.data(), events.size(), timeout);
     // Something's wrong
-    if ((res < 0) && (errno != EINTR)) {
-        WARNING("poll() fail: %s", string::StrError(errno).c_str());
+    if (res < 0) {
+        if (errno == EINTR) {
+            return 0;
+        }
+        WARNING("epoll_wait() fail: %s", string::StrError(errno).c_str());
+        Disconnect();
+        return 0;
+    }
+    // Timeout, no data at the moment
+    if (res == 0) {
+        return 0;
     }
+
+    bool readable = false;
+    bool broken = false;
+    for (int ix = 0; ix < res; ix++) {
+        const int fd = events[ix].data.fd;
+        // Shutdown wakeup. The eventfd is deliberately not drained: it keeps the loop from blocking again until the
+        // worker has noticed the pending abort (see StopDriver()).
+        if (fd == wake_fd_) {
+            return 0;
+        }
+        // Main sensor stream activity
+        else if (fd == sensor_fd_) {
+            if ((events[ix].events & EPOLLIN) != 0) {
+                readable = true;
+            }
+            if ((events[ix].events & (EPOLLHUP | EPOLLERR)) != 0) {
+                broken = true;
+            }
+        }
+        // Extra stream activity: flag it for the worker, which services the extra streams after the main stream
+        // (see Worker() and ReadExtraStream())
+        else {
+            for (std::size_t stream_ix = 0; stream_ix < extra_streams_.size(); stream_ix++) {
+                if (extra_streams_[stream_ix]->fd_ == fd) {
+                    extra_readable_.push_back(stream_ix);
+                    break;
+                }
+            }
+        }
+    }
+
     // We should be able to read some data
-    else if ((poll_fds_[0].revents & POLLIN) != 0) {
+    if (readable) {
+        // Drain as much as the buffer can take in one syscall. Note that we must read in bulk here: the sensor can
+        // stream several tens of kB/s (FP_A-RAWIMU at 200 Hz, NMEA, NOV_B, ...) and per-message-sized reads would
+        // amplify into thousands of syscalls per second.
         ssize_t rv = 0;
         if (serial_) {
             rv = recv(sensor_fd_, buf, size, MSG_DONTWAIT);
         } else {
-            rv = read(sensor_fd_, buf, sizeof(buf));
+            rv = read(sensor_fd_, buf, size);
         }
         // We have some data
         if (rv >= 0) {
+            read_stats_.num_reads_.fetch_add(1, std::memory_order_relaxed);
+            read_stats_.num_bytes_.fetch_add(rv, std::memory_order_relaxed);
+            if ((std::size_t)rv > read_stats_.max_read_.load(std::memory_order_relaxed)) {
+                read_stats_.max_read_.store(rv, std::memory_order_relaxed);  // Single writer, no CAS needed
+            }
             return rv;
         }
         // Perhaps a problem
         else {
             if (errno == EAGAIN) {
                 return 0;
-            } else {
-                WARNING("read/recv fail: %s", string::StrError(errno).c_str());
             }
+            WARNING("read/recv fail: %s", string::StrError(errno).c_str());
         }
     }
     // Connection is broken
-    else if ((poll_fds_[0].revents & (POLLHUP | POLLERR)) != 0) {
-        WARNING("poll() fail");
+    else if (broken) {
+        WARNING("epoll_wait() fail");
     }
-    // Timeout, no data at the moment
+    // Spurious wakeup
     else {
         return 0;
     }
@@ -236,6 +635,75 @@ std::size_t FixpositionDriver::Read(uint8_t* buf, const std::size_t size, const
     return 0;
 }
 
+void FixpositionDriver::ReadExtraStream(const std::size_t stream_ix) {
+    auto& stream = *extra_streams_[stream_ix];
+    if (stream.fd_ < 0) {
+        return;
+    }
+
+    // Same bulk read as for the main stream (see Read()), but feeding the stream's own parser. Messages go into the
+    // same queue, tagged with the stream index so that the dispatch runs the right observers.
+    ssize_t rv = 0;
+    if (stream.serial_) {
+        rv = recv(stream.fd_, read_buf_.data(), read_buf_.size(), MSG_DONTWAIT);
+    } else {
+        rv = read(stream.fd_, read_buf_.data(), read_buf_.size());
+    }
+    if (rv < 0) {
+        if (errno == EAGAIN) {
+            return;
+        }
+        WARNING("read/recv fail on %s: %s", stream.spec_.c_str(), string::StrError(errno).c_str());
+        CloseStream(stream.fd_, stream.serial_, stream.options_save_);
+        stream.fd_ = -1;
+        return;
+    }
+    if (rv == 0) {
+        return;
+    }
+
+    stream.read_stats_.num_reads_++;
+    stream.read_stats_.num_bytes_ += rv;
+    if ((std::size_t)rv > stream.read_stats_.max_read_) {
+        stream.read_stats_.max_read_ = rv;
+    }
+
+    const uint64_t rx_nanos = NowNanos();
+    if (!stream.parser_.Add(read_buf_.data(), rv)) {
+        WARNING("Parser overflow");  // should not happen, as we respect the parser's limits (MAX_ADD_SIZE)
+        stream.parser_.Reset();
+        stream.parser_.Add(read_buf_.data(), rv);
+    }
+
+    QueuedMsg qmsg;
+    while (true) {
+        buffer_pool_.Acquire(qmsg.msg_.data_);
+        if (!stream.parser_.Process(qmsg.msg_)) {
+            buffer_pool_.Release(std::move(qmsg.msg_.data_));
+            break;
+        }
+        IF_TRACE(qmsg.msg_.MakeInfo());
+        TRACE("received %s %" PRIuMAX " -- %s (stream %" PRIuMAX ")", qmsg.msg_.name_.c_str(), qmsg.msg_.data_.size(),
+              qmsg.msg_.info_.c_str(), stream_ix + 1);
+        // Discard messages nobody observes before they cost any decoding or a queue round-trip
+        if (!MsgWanted(stream_ix + 1, qmsg.msg_)) {
+            num_msgs_skipped_.fetch_add(1, std::memory_order_relaxed);
+            buffer_pool_.Release(std::move(qmsg.msg_.data_));
+            continue;
+        }
+        // Drop messages that fall victim to the configured decimation
+        if (MsgDecimated(stream_ix + 1, qmsg.msg_)) {
+            num_msgs_decimated_.fetch_add(1, std::memory_order_relaxed);
+            buffer_pool_.Release(std::move(qmsg.msg_.data_));
+            continue;
+        }
+        qmsg.rx_nanos_ = rx_nanos;
+        qmsg.stream_ = stream_ix + 1;
+        parse_latency_.Record(NowNanos() - rx_nanos);
+        msg_queue_.Push(std::move(qmsg));
+    }
+}
+
 bool FixpositionDriver::Write(const uint8_t* buf, const std::size_t size) {
     if (!IsConnected()) {
         WARNING_THR(1000, "no connection, cannot write");
@@ -255,196 +723,734 @@ bool FixpositionDriver::Write(const uint8_t* buf, const std::size_t size) {
     return (res > 0) && (res == (int)size);
 }
 
+FixpositionDriver::ReadStats FixpositionDriver::GetReadStats() const {
+    ReadStats stats;
+    stats.num_reads_ = read_stats_.num_reads_.load(std::memory_order_relaxed);
+    stats.num_bytes_ = read_stats_.num_bytes_.load(std::memory_order_relaxed);
+    stats.max_read_ = read_stats_.max_read_.load(std::memory_order_relaxed);
+    return stats;
+}
+
+FixpositionDriver::QueueStats FixpositionDriver::GetQueueStats() const {
+    QueueStats stats;
+    stats.depth_ = msg_queue_.Depth();
+    stats.high_watermark_ = msg_queue_.HighWatermark();
+    stats.num_dropped_ = msg_queue_.NumDropped();
+    stats.num_skipped_ = num_msgs_skipped_.load(std::memory_order_relaxed);
+    stats.num_decimated_ = num_msgs_decimated_.load(std::memory_order_relaxed);
+    return stats;
+}
+
+FixpositionDriver::TxStats FixpositionDriver::GetTxStats() const {
+    std::unique_lock<std::mutex> lock(tx_mutex_);
+    return tx_stats_;
+}
+
+FixpositionDriver::Stats FixpositionDriver::GetStats() const {
+    Stats stats;
+    stats.read_ = GetReadStats();
+    stats.queue_ = GetQueueStats();
+    stats.tx_ = GetTxStats();
+    stats.latency_.parse_ = parse_latency_.GetStats();
+    stats.latency_.dispatch_fpa_ = dispatch_latency_fpa_.GetStats();
+    stats.latency_.dispatch_nmea_ = dispatch_latency_nmea_.GetStats();
+    stats.latency_.dispatch_novb_ = dispatch_latency_novb_.GetStats();
+    return stats;
+}
+
 // ---------------------------------------------------------------------------------------------------------------------
 
-bool FixpositionDriver::StartDriver() { return Connect() && worker_.Start(); }
+bool FixpositionDriver::StartDriver() {
+    // Set up the per-stream decimation counters ("<message>:<factor>" entries, see DriverParams::decimation_)
+    decimation_.clear();
+    decimation_.resize(1 + extra_streams_.size());
+    for (const auto& entry : params_.decimation_) {
+        const auto sep = entry.rfind(':');
+        int factor = 0;
+        if ((sep == std::string::npos) || !string::StrToValue(entry.substr(sep + 1), factor) || (factor < 1)) {
+            WARNING("Bad decimation entry: %s", entry.c_str());
+            continue;
+        }
+        if (factor > 1) {
+            const std::string name = entry.substr(0, sep);
+            DEBUG("Decimating %s by %d", name.c_str(), factor);
+            for (auto& stream : decimation_) {
+                stream[name] = {(uint32_t)factor, 0};
+            }
+        }
+    }
+
+    // A failure to open the raw recording is logged but does not prevent the driver from running
+    if (raw_recorder_) {
+        raw_recorder_->Open();
+    }
+
+    // Shared-memory output: like the raw recording, a failure is logged but does not prevent the driver from
+    // running. The records are fed through normal observers, so the messages go through the usual dispatch path
+    // (and are exempted from the no-observer early skip by their registration).
+    if (shm_output_ && shm_output_->Open()) {
+        AddFpaObserver<fpa::FpaOdometryPayload>([this](const fpa::FpaOdometryPayload& payload) {
+            OdometryData odometry_data;
+            odometry_data.SetFromFpaOdomPayload(payload);
+            shm_output_->UpdateOdometry(odometry_data);
+        });
+        AddFpaObserver<fpa::FpaRawimuPayload>(
+            [this](const fpa::FpaRawimuPayload& payload) { shm_output_->UpdateImu(payload); });
+    }
+    return SetupEvents() && Connect() && dispatch_.Start() && tx_worker_.Start() && worker_.Start();
+}
 
 void FixpositionDriver::StopDriver() {
+    // Wake the worker out of epoll_wait(). The eventfd remains readable until the worker has seen the abort flag, so
+    // it cannot re-block in between (see Read()).
+    if (wake_fd_ >= 0) {
+        const uint64_t one = 1;
+        if (write(wake_fd_, &one, sizeof(one)) != sizeof(one)) {
+            WARNING("eventfd write fail: %s", string::StrError(errno).c_str());
+        }
+    }
     worker_.Stop();
+    tx_worker_.Stop();
+    dispatch_.Stop();
     Disconnect();
+    TeardownEvents();
+    if (raw_recorder_) {
+        raw_recorder_->Close();
+    }
+    if (shm_output_) {
+        shm_output_->Close();
+    }
+}
+
+void FixpositionDriver::ApplyThreadSettings(const char* name) {
+    // CPU affinity ("2" or "2,3", empty = don't pin)
+    if (!params_.thread_cpus_.empty()) {
+        cpu_set_t cpus;
+        CPU_ZERO(&cpus);
+        bool cpus_ok = false;
+        for (const auto& str : string::StrSplit(params_.thread_cpus_, ",")) {
+            int cpu = -1;
+            if (string::StrToValue(str, cpu) && (cpu >= 0) && (cpu < CPU_SETSIZE)) {
+                CPU_SET(cpu, &cpus);
+                cpus_ok = true;
+            } else {
+                WARNING("Bad thread_cpus value: %s", params_.thread_cpus_.c_str());
+                cpus_ok = false;
+                break;
+            }
+        }
+        if (cpus_ok) {
+            const int res = pthread_setaffinity_np(pthread_self(), sizeof(cpus), &cpus);
+            if (res != 0) {
+                WARNING("Failed pinning %s thread to CPU(s) %s: %s", name, params_.thread_cpus_.c_str(),
+                        string::StrError(res).c_str());
+            } else {
+                DEBUG("Pinned %s thread to CPU(s) %s", name, params_.thread_cpus_.c_str());
+            }
+        }
+    }
+
+    // Real-time scheduling ("fifo" or "rr" with a priority, empty = default policy). Deterministic wakeup latency
+    // matters more than throughput here: without this, CPU contention from other workloads can make the worker miss
+    // its slot, which shows up as bursty reads and latency spikes on the high-rate topics.
+    if (!params_.thread_sched_.empty()) {
+        int policy = -1;
+        if (params_.thread_sched_ == "fifo") {
+            policy = SCHED_FIFO;
+        } else if (params_.thread_sched_ == "rr") {
+            policy = SCHED_RR;
+        } else {
+            WARNING("Bad thread_sched value: %s", params_.thread_sched_.c_str());
+        }
+        if (policy >= 0) {
+            struct sched_param sched;
+            std::memset(&sched, 0, sizeof(sched));
+            sched.sched_priority = params_.thread_prio_;
+            const int res = pthread_setschedparam(pthread_self(), policy, &sched);
+            if (res != 0) {
+                // Typically EPERM: the process lacks CAP_SYS_NICE resp. a suitable RLIMIT_RTPRIO
+                WARNING("Failed setting %s thread to %s priority %d: %s", name, params_.thread_sched_.c_str(),
+                        params_.thread_prio_, string::StrError(res).c_str());
+            } else {
+                DEBUG("Set %s thread to %s priority %d", name, params_.thread_sched_.c_str(), params_.thread_prio_);
+            }
+        }
+    }
 }
 
 void FixpositionDriver::Worker(void* /*arg*/) {
+    ApplyThreadSettings("driver");
     INFO("Driver running...");
 
     while (!worker_.ShouldAbort()) {
         // While we're connected to the sensor...
         if (IsConnected()) {
-            // Read more data from sensor and feed the parser
-            uint8_t buf[parser::MAX_ADD_SIZE];
-            const std::size_t size = Read(buf, sizeof(buf), 337);
-            if (size == 0) {
-                continue;  // try again
-            }
-            if (!parser_.Add(buf, size)) {
-                WARNING("Parser overflow");  // should not happen, as we respect the parser's limits (MAX_ADD_SIZE)
-                parser_.Reset();
-                parser_.Add(buf, size);
+            // Read more data from sensor and feed the parser. We reuse one large buffer for the entire lifetime of the
+            // driver so that each wakeup drains the socket with a single bulk read() and no allocations. The read
+            // blocks until data arrives or StopDriver() signals the wakeup eventfd, i.e. an idle sensor causes no
+            // wakeups at all.
+            if (read_buf_.size() != parser::MAX_ADD_SIZE) {
+                read_buf_.resize(parser::MAX_ADD_SIZE);
             }
+            const std::size_t size = Read(read_buf_.data(), read_buf_.size(), -1);
+            if (size > 0) {
+                if (raw_recorder_) {
+                    raw_recorder_->Record(read_buf_.data(), size);
+                }
+                const uint64_t rx_nanos = NowNanos();
+                if (!parser_.Add(read_buf_.data(), size)) {
+                    WARNING("Parser overflow");  // should not happen, as we respect the parser's limits (MAX_ADD_SIZE)
+                    parser_.Reset();
+                    parser_.Add(read_buf_.data(), size);
+                }
 
-            // Process received message(s)
-            parser::ParserMsg msg;
-            while (parser_.Process(msg)) {
-                IF_TRACE(msg.MakeInfo());
-                TRACE("received %s %" PRIuMAX " -- %s", msg.name_.c_str(), msg.data_.size(), msg.info_.c_str());
-                switch (msg.proto_) {
-                    case parser::Protocol::FP_A:
-                        NotifyFpaObservers(msg);
-                        break;
-                    case parser::Protocol::NMEA:
-                        NotifyNmeaObservers(msg);
-                        break;
-                    case parser::Protocol::NOV_B:
-                        NotifyNovbObservers(msg);
-                        break;
-                    case parser::Protocol::FP_B:
-                    case parser::Protocol::UBX:
-                    case parser::Protocol::RTCM3:
-                    case parser::Protocol::UNI_B:
-                    case parser::Protocol::SPARTN:
-                    case parser::Protocol::OTHER:
+                // Hand received message(s) to the dispatch thread. Message data buffers are recycled through the pool
+                // so that in steady state no allocations happen on this path.
+                QueuedMsg qmsg;
+                while (true) {
+                    buffer_pool_.Acquire(qmsg.msg_.data_);
+                    if (!parser_.Process(qmsg.msg_)) {
+                        buffer_pool_.Release(std::move(qmsg.msg_.data_));
                         break;
+                    }
+                    IF_TRACE(qmsg.msg_.MakeInfo());
+                    TRACE("received %s %" PRIuMAX " -- %s", qmsg.msg_.name_.c_str(), qmsg.msg_.data_.size(),
+                          qmsg.msg_.info_.c_str());
+                    // Discard messages nobody observes before they cost any decoding or a queue round-trip
+                    if (!MsgWanted(0, qmsg.msg_)) {
+                        num_msgs_skipped_.fetch_add(1, std::memory_order_relaxed);
+                        buffer_pool_.Release(std::move(qmsg.msg_.data_));
+                        continue;
+                    }
+                    // Drop messages that fall victim to the configured decimation
+                    if (MsgDecimated(0, qmsg.msg_)) {
+                        num_msgs_decimated_.fetch_add(1, std::memory_order_relaxed);
+                        buffer_pool_.Release(std::move(qmsg.msg_.data_));
+                        continue;
+                    }
+                    qmsg.rx_nanos_ = rx_nanos;
+                    qmsg.stream_ = 0;
+                    parse_latency_.Record(NowNanos() - rx_nanos);
+                    msg_queue_.Push(std::move(qmsg));
                 }
-                NotifyRawObservers(msg);
+            }
+
+            // Service the extra streams that Read() flagged readable
+            if (!extra_readable_.empty()) {
+                for (const auto stream_ix : extra_readable_) {
+                    ReadExtraStream(stream_ix);
+                }
+                extra_readable_.clear();
             }
         }
         // Reconnect after some time...
         else {
-            INFO("Reconnecting in %.1f seconds...", params_.reconnect_delay_);
-            if (worker_.Sleep(params_.reconnect_delay_ * 1000)) {
+            // A finished file replay ends the worker, there is nothing to reconnect to
+            if (replay_done_) {
+                break;
+            }
+            if (!Reconnect()) {
                 break;
             }
-            Connect();
         }
     }
 }
 
+void FixpositionDriver::Dispatch(void* /*arg*/) {
+    ApplyThreadSettings("dispatch");
+    DEBUG("Dispatch running...");
+
+    QueuedMsg qmsg;
+    while (!dispatch_.ShouldAbort()) {
+        // Wait for parsed messages from the worker and run the observers. The wait times out regularly so that we
+        // notice a pending shutdown even when the sensor has gone quiet.
+        if (!msg_queue_.Wait(337)) {
+            continue;
+        }
+        while (msg_queue_.Pop(qmsg)) {
+            // Load the current observer set once per message (RCU-style, see UpdateObserverSet()), so runtime
+            // observer and skip-set updates never block this thread
+            const auto set = std::atomic_load(&observers_);
+            DispatchMsg(*set, qmsg.stream_, qmsg.msg_);
+            // Record the receive-to-observers-done latency for the message classes we decode
+            const uint64_t latency = NowNanos() - qmsg.rx_nanos_;
+            switch (qmsg.msg_.proto_) {  // clang-format off
+                case parser::Protocol::FP_A:  dispatch_latency_fpa_.Record(latency);   break;
+                case parser::Protocol::NMEA:  dispatch_latency_nmea_.Record(latency);  break;
+                case parser::Protocol::NOV_B: dispatch_latency_novb_.Record(latency);  break;
+                default: break;
+            }  // clang-format on
+            // Hand the message to the ref-counted observers, or recycle the buffer right away. The shared view's
+            // deleter returns the buffer to the pool once the last observer lets go of the message.
+            if (!set->shared_raw_.empty()) {
+                SharedParserMsg shared(new parser::ParserMsg(std::move(qmsg.msg_)), [this](const parser::ParserMsg* m) {
+                    buffer_pool_.Release(std::move(const_cast<parser::ParserMsg*>(m)->data_));
+                    delete m;
+                });
+                for (auto& obs : set->shared_raw_) {
+                    obs(shared);
+                }
+            } else {
+                buffer_pool_.Release(std::move(qmsg.msg_.data_));
+            }
+        }
+    }
+}
+
+void FixpositionDriver::DispatchMsg(const ObserverSet& set, const std::size_t stream, const parser::ParserMsg& msg) {
+    if (stream >= set.streams_.size()) {
+        return;
+    }
+    switch (msg.proto_) {
+        case parser::Protocol::FP_A:
+            NotifyFpaObservers(set, stream, msg);
+            break;
+        case parser::Protocol::NMEA:
+            NotifyNmeaObservers(set, stream, msg);
+            break;
+        case parser::Protocol::NOV_B:
+            NotifyNovbObservers(set, stream, msg);
+            break;
+        case parser::Protocol::FP_B:
+        case parser::Protocol::UBX:
+        case parser::Protocol::RTCM3:
+        case parser::Protocol::UNI_B:
+        case parser::Protocol::SPARTN:
+        case parser::Protocol::OTHER:
+            break;
+    }
+    NotifyRawObservers(set, stream, msg);
+}
+
+void FixpositionDriver::TxWorker(void* /*arg*/) {
+    ApplyThreadSettings("tx");
+    DEBUG("TX running...");
+
+    std::vector<uint8_t> data;
+    while (!tx_worker_.ShouldAbort()) {
+        {
+            std::unique_lock<std::mutex> lock(tx_mutex_);
+            // Wait for queued messages. The wait times out regularly so that we notice a pending shutdown even when
+            // nothing is being sent.
+            if (tx_queue_speed_.empty() && tx_queue_corr_.empty()) {
+                tx_cond_.wait_for(lock, std::chrono::milliseconds(337));
+            }
+            // Wheelspeed measurements preempt bulk correction data
+            if (!tx_queue_speed_.empty()) {
+                data = std::move(tx_queue_speed_.front());
+                tx_queue_speed_.pop_front();
+            } else if (!tx_queue_corr_.empty()) {
+                data = std::move(tx_queue_corr_.front());
+                tx_queue_corr_.pop_front();
+            } else {
+                continue;
+            }
+        }
+
+        const bool ok = Write(data.data(), data.size());
+        if (!ok) {
+            WARNING_THR(1000, "Failed writing data (%" PRIuMAX " bytes) to sensor", data.size());
+        }
+
+        {
+            std::unique_lock<std::mutex> lock(tx_mutex_);
+            if (ok) {
+                tx_stats_.num_sent_++;
+            } else {
+                tx_stats_.num_failed_++;
+            }
+        }
+
+        // Recycle the frame buffer
+        tx_buffer_pool_.Release(std::move(data));
+    }
+}
+
+void FixpositionDriver::EnqueueTx(std::deque<std::vector<uint8_t>>& queue, const std::size_t capacity,
+                                  std::vector<uint8_t>&& data) {
+    {
+        std::unique_lock<std::mutex> lock(tx_mutex_);
+        while (queue.size() >= capacity) {
+            tx_buffer_pool_.Release(std::move(queue.front()));
+            queue.pop_front();
+            tx_stats_.num_dropped_++;
+        }
+        queue.push_back(std::move(data));
+    }
+    tx_cond_.notify_one();
+}
+
 // ---------------------------------------------------------------------------------------------------------------------
 
-void FixpositionDriver::AddFpaObserver(const std::string& message_name, FpaObserver observer) {
-    DEBUG("Adding FP_A observer for %s", message_name.c_str());
-    auto entry = fpa_observers_.find(message_name);
-    if (entry == fpa_observers_.end()) {
-        entry = fpa_observers_.insert({message_name, {}}).first;
+// Dispatch engine for FP_A and NMEA messages. Each known message has an entry with its name (resp. formatter) and a
+// decode-and-notify function instantiated from a template at compile time. Message names are resolved to dense indices
+// into these tables once (at registration time, and via a sorted lookup at dispatch time), so the hot path does no
+// string hashing and no linear if/else chain of string comparisons.
+
+template <typename PayloadT, typename ObserverT>
+static bool DecodeAndNotify(const ParserMsg& msg, const std::vector<ObserverT>& observers) {
+    PayloadT payload;
+    if (!payload.SetFromMsg(msg.data_.data(), msg.data_.size())) {
+        return false;
     }
-    entry->second.push_back(observer);
+    for (auto& obs : observers) {
+        obs(payload);
+    }
+    return true;
 }
 
-void FixpositionDriver::RemoveFpaObservers() { fpa_observers_.clear(); }
+struct FpaDispatchEntry {
+    const char* name_;
+    bool (*decode_and_notify_)(const ParserMsg&, const std::vector<FixpositionDriver::FpaObserver>&);
+};
 
-void FixpositionDriver::NotifyFpaObservers(const ParserMsg& msg) {
-    auto entry = fpa_observers_.find(msg.name_);
-    if ((entry != fpa_observers_.end()) && !entry->second.empty()) {
-        TRACE("notify fpa %s", msg.name_.c_str());
+template <typename PayloadT>
+static FpaDispatchEntry FpaEntry() {
+    return {PayloadT::MSG_NAME, DecodeAndNotify<PayloadT, FixpositionDriver::FpaObserver>};
+}
 
-#define _DISPATCH(_type_)                                                                                          \
-    else if (msg.name_ == _type_::MSG_NAME) {                                                                      \
-        _type_ payload;                                                                                            \
-        if (payload.SetFromMsg(msg.data_.data(), msg.data_.size())) {                                              \
-            for (auto& obs : entry->second) {                                                                      \
-                obs(payload);                                                                                      \
-            }                                                                                                      \
-        } else {                                                                                                   \
-            msg.MakeInfo();                                                                                        \
-            WARNING_THR(1000, "Failed decoding %s: %s", msg.name_.c_str(), msg.info_.c_str());                     \
-            TRACE_HEXDUMP(msg.data_.data(), msg.data_.size(), "    ", "Failed decoding %s: %s", msg.name_.c_str(), \
-                          msg.info_.c_str());                                                                      \
-        }                                                                                                          \
+static const std::array<FpaDispatchEntry, FixpositionDriver::NUM_FPA_MSGS> FPA_DISPATCH = {{
+    FpaEntry<fpa::FpaEoePayload>(),
+    FpaEntry<fpa::FpaGnssantPayload>(),
+    FpaEntry<fpa::FpaGnsscorrPayload>(),
+    FpaEntry<fpa::FpaRawimuPayload>(),
+    FpaEntry<fpa::FpaCorrimuPayload>(),
+    FpaEntry<fpa::FpaImubiasPayload>(),
+    FpaEntry<fpa::FpaLlhPayload>(),
+    FpaEntry<fpa::FpaOdometryPayload>(),
+    FpaEntry<fpa::FpaOdomshPayload>(),
+    FpaEntry<fpa::FpaOdomenuPayload>(),
+    FpaEntry<fpa::FpaOdomstatusPayload>(),
+    FpaEntry<fpa::FpaTextPayload>(),
+    FpaEntry<fpa::FpaTfPayload>(),
+    FpaEntry<fpa::FpaTpPayload>(),
+}};
+
+// Like DecodeAndNotify(), but for NMEA messages: the consumer (if any) runs last and gets the payload as an rvalue,
+// so the sentence is decoded exactly once and the decoded payload can be moved on instead of copied
+template <typename PayloadT>
+static bool DecodeAndNotifyNmea(const ParserMsg& msg, const std::vector<FixpositionDriver::NmeaObserver>& observers,
+                                const FixpositionDriver::NmeaConsumer& consumer) {
+    PayloadT payload;
+    if (!payload.SetFromMsg(msg.data_.data(), msg.data_.size())) {
+        return false;
+    }
+    for (auto& obs : observers) {
+        obs(payload);
+    }
+    if (consumer) {
+        consumer(std::move(payload));
     }
+    return true;
+}
 
-        if (false) {
+struct NmeaDispatchEntry {
+    const char* name_;  //!< The formatter ("GGA", "RMC", ...)
+    bool (*decode_and_notify_)(const ParserMsg&, const std::vector<FixpositionDriver::NmeaObserver>&,
+                               const FixpositionDriver::NmeaConsumer&);
+};
+
+template <typename PayloadT>
+static NmeaDispatchEntry NmeaEntry() {
+    return {PayloadT::FORMATTER, DecodeAndNotifyNmea<PayloadT>};
+}
+
+static const std::array<NmeaDispatchEntry, FixpositionDriver::NUM_NMEA_MSGS> NMEA_DISPATCH = {{
+    NmeaEntry<nmea::NmeaGgaPayload>(),
+    NmeaEntry<nmea::NmeaGllPayload>(),
+    NmeaEntry<nmea::NmeaRmcPayload>(),
+    NmeaEntry<nmea::NmeaVtgPayload>(),
+    NmeaEntry<nmea::NmeaGstPayload>(),
+    NmeaEntry<nmea::NmeaHdtPayload>(),
+    NmeaEntry<nmea::NmeaZdaPayload>(),
+    NmeaEntry<nmea::NmeaGsaPayload>(),
+    NmeaEntry<nmea::NmeaGsvPayload>(),
+}};
+
+// Resolve a message name (resp. formatter) to its dispatch table index (< 0 if unknown), using a name-sorted index
+// built once on first use
+template <typename EntryT, std::size_t N>
+static int DispatchIndex(const std::array<EntryT, N>& table, const char* name) {
+    static const std::array<int, N> sorted = [&table]() {
+        std::array<int, N> ixs;
+        for (std::size_t ix = 0; ix < N; ix++) {
+            ixs[ix] = ix;
+        }
+        std::sort(ixs.begin(), ixs.end(),
+                  [&table](const int a, const int b) { return std::strcmp(table[a].name_, table[b].name_) < 0; });
+        return ixs;
+    }();
+    int lo = 0;
+    int hi = (int)N - 1;
+    while (lo <= hi) {
+        const int mid = (lo + hi) / 2;
+        const int cmp = std::strcmp(table[sorted[mid]].name_, name);
+        if (cmp == 0) {
+            return sorted[mid];
+        } else if (cmp < 0) {
+            lo = mid + 1;
+        } else {
+            hi = mid - 1;
+        }
+    }
+    return -1;
+}
+
+static int FpaMsgIndex(const char* name) { return DispatchIndex(FPA_DISPATCH, name); }
+
+static int NmeaMsgIndex(const char* formatter) { return DispatchIndex(NMEA_DISPATCH, formatter); }
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+bool FixpositionDriver::MsgWanted(const std::size_t stream, const parser::ParserMsg& msg) const {
+    const auto set = std::atomic_load(&observers_);
+    // Raw observers see every message on every stream
+    if (!set->shared_raw_.empty()) {
+        return true;
+    }
+    if (stream >= set->streams_.size()) {
+        return false;
+    }
+    const auto& observers = set->streams_[stream];
+    if (!observers.raw_.empty()) {
+        return true;
+    }
+    switch (msg.proto_) {
+        case parser::Protocol::FP_A: {
+            const int ix = FpaMsgIndex(msg.name_.c_str());
+            return (ix >= 0) && !observers.fpa_[ix].empty() && !MsgDisabled(*set, msg.name_.c_str());
+        }
+        case parser::Protocol::NMEA: {
+            // The parser names NMEA sentences "NMEA-<talker>-<formatter>", so the formatter needed for the observer
+            // lookup is available without extracting the message meta data
+            const auto sep = msg.name_.rfind('-');
+            if (sep == std::string::npos) {
+                return false;
+            }
+            const char* formatter = &msg.name_[sep + 1];
+            const int ix = NmeaMsgIndex(formatter);
+            return (ix >= 0) && (!observers.nmea_[ix].empty() || observers.nmea_consumer_[ix]) &&
+                   !MsgDisabled(*set, formatter);
+        }
+        case parser::Protocol::NOV_B: {
+            const auto entry = observers.novb_.find(msg.name_);
+            return (entry != observers.novb_.end()) && !entry->second.empty() && !MsgDisabled(*set, msg.name_.c_str());
         }
-        _DISPATCH(fpa::FpaEoePayload)
-        _DISPATCH(fpa::FpaGnssantPayload)
-        _DISPATCH(fpa::FpaGnsscorrPayload)
-        _DISPATCH(fpa::FpaRawimuPayload)
-        _DISPATCH(fpa::FpaCorrimuPayload)
-        _DISPATCH(fpa::FpaImubiasPayload)
-        _DISPATCH(fpa::FpaLlhPayload)
-        _DISPATCH(fpa::FpaOdometryPayload)
-        _DISPATCH(fpa::FpaOdomshPayload)
-        _DISPATCH(fpa::FpaOdomenuPayload)
-        _DISPATCH(fpa::FpaOdomstatusPayload)
-        _DISPATCH(fpa::FpaTextPayload)
-        _DISPATCH(fpa::FpaTfPayload)
-        _DISPATCH(fpa::FpaTpPayload)
+        // The remaining protocols are only ever handed to raw observers, which were checked above
+        default:
+            return false;
+    }
+}
+
+bool FixpositionDriver::MsgDisabled(const ObserverSet& set, const char* name) {
+    // The string is only constructed when messages are actually disabled, so with an empty skip-set (the default)
+    // this is a single branch per message
+    return !set.disabled_.empty() && (set.disabled_.find(std::string(name)) != set.disabled_.end());
+}
 
-#undef _DISPATCH
+bool FixpositionDriver::MsgDecimated(const std::size_t stream, const parser::ParserMsg& msg) {
+    if (stream >= decimation_.size()) {
+        return false;
+    }
+    auto& decimation = decimation_[stream];
+    if (decimation.empty()) {
+        return false;
+    }
+    const auto entry = decimation.find(msg.name_);
+    if (entry == decimation.end()) {
+        return false;
     }
+    auto& state = entry->second;
+    state.count_++;
+    if (state.count_ >= state.factor_) {
+        state.count_ = 0;
+        return false;  // This one is kept
+    }
+    return true;
 }
 
 // ---------------------------------------------------------------------------------------------------------------------
 
-void FixpositionDriver::AddNmeaObserver(const std::string& formatter, NmeaObserver observer) {
-    DEBUG("Adding NMEA observer for %s", formatter.c_str());
-    auto entry = nmea_observers_.find(formatter);
-    if (entry == nmea_observers_.end()) {
-        entry = nmea_observers_.insert({formatter, {}}).first;
+void FixpositionDriver::UpdateObserverSet(const std::function<void(ObserverSet&)>& modify) {
+    // RCU-style copy-update-swap: writers are serialised by the mutex and publish a modified copy of the set, while
+    // the worker and dispatch threads keep using whatever set they loaded for the message at hand (the old copy
+    // lives until the last reader drops its reference)
+    std::unique_lock<std::mutex> lock(observers_mutex_);
+    auto set = std::make_shared<ObserverSet>(*observers_);
+    modify(*set);
+    std::atomic_store(&observers_, std::shared_ptr<const ObserverSet>(std::move(set)));
+}
+
+void FixpositionDriver::SetMessageEnabled(const std::string& message, const bool enable) {
+    INFO("%s message %s", enable ? "Enabling" : "Disabling", message.c_str());
+    UpdateObserverSet([&message, enable](ObserverSet& set) {
+        if (enable) {
+            set.disabled_.erase(message);
+        } else {
+            set.disabled_.insert(message);
+        }
+    });
+}
+
+void FixpositionDriver::SetDisabledMessages(const std::vector<std::string>& messages) {
+    DEBUG("Setting %" PRIuMAX " disabled messages", messages.size());
+    UpdateObserverSet([&messages](ObserverSet& set) {
+        set.disabled_.clear();
+        set.disabled_.insert(messages.begin(), messages.end());
+    });
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+void FixpositionDriver::AddFpaObserver(const std::string& message_name, FpaObserver observer,
+                                       const std::size_t stream) {
+    DEBUG("Adding FP_A observer for %s (stream %" PRIuMAX ")", message_name.c_str(), stream);
+    const int ix = FpaMsgIndex(message_name.c_str());
+    if (ix < 0) {
+        WARNING("Unknown FP_A message %s", message_name.c_str());
+        return;
+    }
+    if (stream >= std::atomic_load(&observers_)->streams_.size()) {
+        WARNING("No such stream %" PRIuMAX, stream);
+        return;
     }
-    entry->second.push_back(observer);
+    UpdateObserverSet([&](ObserverSet& set) { set.streams_[stream].fpa_[ix].push_back(observer); });
 }
 
-void FixpositionDriver::RemoveNmeaObservers() { nmea_observers_.clear(); }
+void FixpositionDriver::RemoveFpaObservers() {
+    UpdateObserverSet([](ObserverSet& set) {
+        for (auto& stream : set.streams_) {
+            for (auto& observers : stream.fpa_) {
+                observers.clear();
+            }
+        }
+    });
+}
 
-void FixpositionDriver::NotifyNmeaObservers(const fpsdk::common::parser::ParserMsg& msg) {
-    // NMEA observers are registered using the formatter (e.g. "RMC"), ignoring the talker ("GP", "GN", etc.)
-    nmea::NmeaMessageMeta meta;
-    if (!nmea::NmeaGetMessageMeta(meta, msg.data_.data(), msg.data_.size())) {
-        WARNING_THR(1000, "Failed decoding %s", msg.name_.c_str());
+void FixpositionDriver::NotifyFpaObservers(const ObserverSet& set, const std::size_t stream, const ParserMsg& msg) {
+    const auto& fpa_observers = set.streams_[stream].fpa_;
+    const int ix = FpaMsgIndex(msg.name_.c_str());
+    if ((ix < 0) || fpa_observers[ix].empty() || MsgDisabled(set, msg.name_.c_str())) {
         return;
     }
+    TRACE("notify fpa %s", msg.name_.c_str());
+    if (!FPA_DISPATCH[ix].decode_and_notify_(msg, fpa_observers[ix])) {
+        msg.MakeInfo();
+        WARNING_THR(1000, "Failed decoding %s: %s", msg.name_.c_str(), msg.info_.c_str());
+        TRACE_HEXDUMP(msg.data_.data(), msg.data_.size(), "    ", "Failed decoding %s: %s", msg.name_.c_str(),
+                      msg.info_.c_str());
+    }
+}
 
-    auto entry = nmea_observers_.find(meta.formatter_);
-    if ((entry != nmea_observers_.end()) && !entry->second.empty()) {
-        TRACE("notify nmea %s (%s)", meta.formatter_, msg.name_.c_str());
+// ---------------------------------------------------------------------------------------------------------------------
 
-#define _DISPATCH(_type_)                                                                                          \
-    else if (std::strcmp(meta.formatter_, _type_::FORMATTER) == 0) {                                               \
-        _type_ payload;                                                                                            \
-        if (payload.SetFromMsg(msg.data_.data(), msg.data_.size())) {                                              \
-            for (auto& obs : entry->second) {                                                                      \
-                obs(payload);                                                                                      \
-            }                                                                                                      \
-        } else {                                                                                                   \
-            msg.MakeInfo();                                                                                        \
-            WARNING_THR(1000, "Bad %s: %s", msg.name_.c_str(), msg.info_.c_str());                                 \
-            TRACE_HEXDUMP(msg.data_.data(), msg.data_.size(), "    ", "Failed decoding %s: %s", msg.name_.c_str(), \
-                          msg.info_.c_str());                                                                      \
-        }                                                                                                          \
+void FixpositionDriver::AddNmeaObserver(const std::string& formatter, NmeaObserver observer,
+                                        const std::size_t stream) {
+    DEBUG("Adding NMEA observer for %s (stream %" PRIuMAX ")", formatter.c_str(), stream);
+    const int ix = NmeaMsgIndex(formatter.c_str());
+    if (ix < 0) {
+        WARNING("Unknown NMEA formatter %s", formatter.c_str());
+        return;
     }
+    if (stream >= std::atomic_load(&observers_)->streams_.size()) {
+        WARNING("No such stream %" PRIuMAX, stream);
+        return;
+    }
+    UpdateObserverSet([&](ObserverSet& set) { set.streams_[stream].nmea_[ix].push_back(observer); });
+}
 
-        if (false) {
+void FixpositionDriver::SetNmeaConsumer(const std::string& formatter, NmeaConsumer consumer,
+                                        const std::size_t stream) {
+    DEBUG("Setting NMEA consumer for %s (stream %" PRIuMAX ")", formatter.c_str(), stream);
+    const int ix = NmeaMsgIndex(formatter.c_str());
+    if (ix < 0) {
+        WARNING("Unknown NMEA formatter %s", formatter.c_str());
+        return;
+    }
+    if (stream >= std::atomic_load(&observers_)->streams_.size()) {
+        WARNING("No such stream %" PRIuMAX, stream);
+        return;
+    }
+    UpdateObserverSet([&](ObserverSet& set) {
+        if (set.streams_[stream].nmea_consumer_[ix]) {
+            WARNING("Replacing NMEA consumer for %s (stream %" PRIuMAX ")", formatter.c_str(), stream);
         }
-        _DISPATCH(nmea::NmeaGgaPayload)
-        _DISPATCH(nmea::NmeaGllPayload)
-        _DISPATCH(nmea::NmeaRmcPayload)
-        _DISPATCH(nmea::NmeaVtgPayload)
-        _DISPATCH(nmea::NmeaGstPayload)
-        _DISPATCH(nmea::NmeaHdtPayload)
-        _DISPATCH(nmea::NmeaZdaPayload)
-        _DISPATCH(nmea::NmeaGsaPayload)
-        _DISPATCH(nmea::NmeaGsvPayload)
+        set.streams_[stream].nmea_consumer_[ix] = consumer;
+    });
+}
 
-#undef _DISPATCH
+void FixpositionDriver::RemoveNmeaObservers() {
+    UpdateObserverSet([](ObserverSet& set) {
+        for (auto& stream : set.streams_) {
+            for (auto& observers : stream.nmea_) {
+                observers.clear();
+            }
+            for (auto& consumer : stream.nmea_consumer_) {
+                consumer = nullptr;
+            }
+        }
+    });
+}
+
+void FixpositionDriver::NotifyNmeaObservers(const ObserverSet& set, const std::size_t stream,
+                                            const fpsdk::common::parser::ParserMsg& msg) {
+    // NMEA observers are registered using the formatter (e.g. "RMC"), ignoring the talker ("GP", "GN", etc.). As in
+    // MsgWanted(), the formatter comes from the parser's message name ("NMEA-<talker>-<formatter>"), so there is no
+    // need to scan the sentence for its meta data here: the only pass over the sentence is the payload decode in
+    // the dispatch entry
+    const auto sep = msg.name_.rfind('-');
+    if (sep == std::string::npos) {
+        WARNING_THR(1000, "Bad NMEA message name %s", msg.name_.c_str());
+        return;
+    }
+    const char* formatter = &msg.name_[sep + 1];
+
+    const auto& observers = set.streams_[stream];
+    const int ix = NmeaMsgIndex(formatter);
+    if ((ix < 0) || (observers.nmea_[ix].empty() && !observers.nmea_consumer_[ix]) || MsgDisabled(set, formatter)) {
+        return;
+    }
+    TRACE("notify nmea %s (%s)", formatter, msg.name_.c_str());
+    if (!NMEA_DISPATCH[ix].decode_and_notify_(msg, observers.nmea_[ix], observers.nmea_consumer_[ix])) {
+        msg.MakeInfo();
+        WARNING_THR(1000, "Bad %s: %s", msg.name_.c_str(), msg.info_.c_str());
+        TRACE_HEXDUMP(msg.data_.data(), msg.data_.size(), "    ", "Failed decoding %s: %s", msg.name_.c_str(),
+                      msg.info_.c_str());
     }
 }
 
 // ---------------------------------------------------------------------------------------------------------------------
 
-void FixpositionDriver::AddNovbObserver(const std::string& message_name, NovbObserver observer) {
-    DEBUG("Adding NOV_B observer for %s", message_name.c_str());
-    auto entry = novb_observers_.find(message_name);
-    if (entry == novb_observers_.end()) {
-        entry = novb_observers_.insert({message_name, {}}).first;
+void FixpositionDriver::AddNovbObserver(const std::string& message_name, NovbObserver observer,
+                                        const std::size_t stream) {
+    DEBUG("Adding NOV_B observer for %s (stream %" PRIuMAX ")", message_name.c_str(), stream);
+    if (stream >= std::atomic_load(&observers_)->streams_.size()) {
+        WARNING("No such stream %" PRIuMAX, stream);
+        return;
     }
-    entry->second.push_back(observer);
+    UpdateObserverSet([&](ObserverSet& set) {
+        auto& novb_observers = set.streams_[stream].novb_;
+        auto entry = novb_observers.find(message_name);
+        if (entry == novb_observers.end()) {
+            entry = novb_observers.insert({message_name, {}}).first;
+        }
+        entry->second.push_back(observer);
+    });
 }
 
-void FixpositionDriver::RemoveNovbObservers() { novb_observers_.clear(); }
+void FixpositionDriver::RemoveNovbObservers() {
+    UpdateObserverSet([](ObserverSet& set) {
+        for (auto& stream : set.streams_) {
+            stream.novb_.clear();
+        }
+    });
+}
 
-void FixpositionDriver::NotifyNovbObservers(const fpsdk::common::parser::ParserMsg& msg) {
-    auto entry = novb_observers_.find(msg.name_);
-    if ((entry != novb_observers_.end()) && !entry->second.empty()) {
+void FixpositionDriver::NotifyNovbObservers(const ObserverSet& set, const std::size_t stream,
+                                            const fpsdk::common::parser::ParserMsg& msg) {
+    const auto& novb_observers = set.streams_[stream].novb_;
+    const auto entry = novb_observers.find(msg.name_);
+    if ((entry != novb_observers.end()) && !entry->second.empty() && !MsgDisabled(set, msg.name_.c_str())) {
         TRACE("notify novb %s", msg.name_.c_str());
 
         const uint8_t* frame = msg.data_.data();
@@ -459,30 +1465,49 @@ void FixpositionDriver::NotifyNovbObservers(const fpsdk::common::parser::ParserM
 
 // ---------------------------------------------------------------------------------------------------------------------
 
-void FixpositionDriver::AddRawObserver(RawObserver observer) {
-    DEBUG("Adding observer for raw messages");
-    raw_observers_.push_back(observer);
+void FixpositionDriver::AddRawObserver(RawObserver observer, const std::size_t stream) {
+    DEBUG("Adding observer for raw messages (stream %" PRIuMAX ")", stream);
+    if (stream >= std::atomic_load(&observers_)->streams_.size()) {
+        WARNING("No such stream %" PRIuMAX, stream);
+        return;
+    }
+    UpdateObserverSet([&](ObserverSet& set) { set.streams_[stream].raw_.push_back(observer); });
 }
 
-void FixpositionDriver::NotifyRawObservers(const fpsdk::common::parser::ParserMsg& msg) {
-    if (!raw_observers_.empty()) {
+void FixpositionDriver::AddSharedRawObserver(SharedRawObserver observer) {
+    DEBUG("Adding observer for shared raw messages");
+    UpdateObserverSet([&](ObserverSet& set) { set.shared_raw_.push_back(observer); });
+}
+
+void FixpositionDriver::NotifyRawObservers(const ObserverSet& set, const std::size_t stream,
+                                           const fpsdk::common::parser::ParserMsg& msg) {
+    const auto& raw_observers = set.streams_[stream].raw_;
+    if (!raw_observers.empty()) {
         TRACE("notify raw %s", msg.name_.c_str());
-        for (auto& obs : raw_observers_) {
+        for (auto& obs : raw_observers) {
             obs(msg);
         }
     }
 }
 
-void FixpositionDriver::RemoveRawObservers() { raw_observers_.clear(); }
+void FixpositionDriver::RemoveRawObservers() {
+    UpdateObserverSet([](ObserverSet& set) {
+        for (auto& stream : set.streams_) {
+            stream.raw_.clear();
+        }
+        set.shared_raw_.clear();
+    });
+}
 
 // ---------------------------------------------------------------------------------------------------------------------
 
 void FixpositionDriver::SendCorrectionData(const uint8_t* msg, const std::size_t size) {
     // TODO: Check that RTCM message is valid. Maybe run the data through a Parser?
     TRACE("Send correction data (%" PRIuMAX " bytes)", size);
-    if (!Write(msg, size)) {
-        WARNING_THR(1000, "Failed sending correction data");
-    }
+    std::vector<uint8_t> data;
+    tx_buffer_pool_.Acquire(data);
+    data.assign(msg, msg + size);
+    EnqueueTx(tx_queue_corr_, TX_QUEUE_CAPACITY_CORR, std::move(data));
 }
 
 // ---------------------------------------------------------------------------------------------------------------------
@@ -500,14 +1525,11 @@ void FixpositionDriver::SendWheelspeedData(const std::vector<WheelSpeedData>& da
         fpb::FpbMeasurementsMeas meas = {0};
 
         meas.meas_type = types::EnumToVal(fpb::FpbMeasurementsMeasType::VELOCITY);
-        // clang-format off
-        if      (wheel.location_ == "RC") { meas.meas_loc = types::EnumToVal(parser::fpb::FpbMeasurementsMeasLoc::RC); }
-        else if (wheel.location_ == "FR") { meas.meas_loc = types::EnumToVal(parser::fpb::FpbMeasurementsMeasLoc::FR); }
-        else if (wheel.location_ == "FL") { meas.meas_loc = types::EnumToVal(parser::fpb::FpbMeasurementsMeasLoc::FL); }
-        else if (wheel.location_ == "RR") { meas.meas_loc = types::EnumToVal(parser::fpb::FpbMeasurementsMeasLoc::RR); }
-        else if (wheel.location_ == "RL") { meas.meas_loc = types::EnumToVal(parser::fpb::FpbMeasurementsMeasLoc::RL); }
-        else                              { meas.meas_loc = types::EnumToVal(parser::fpb::FpbMeasurementsMeasLoc::UNSPECIFIED); meas_ok = false; }
-        // clang-format on
+        // The location string was already resolved to the enum when the data was converted (see WheelspeedLocation())
+        meas.meas_loc = types::EnumToVal(wheel.location_);
+        if (wheel.location_ == fpb::FpbMeasurementsMeasLoc::UNSPECIFIED) {
+            meas_ok = false;
+        }
         meas.timestamp_type = types::EnumToVal(fpb::FpbMeasurementsTimestampType::TIMEOFARRIVAL);
         meas.meas_x_valid = wheel.vx_valid_;
         meas.meas_x = wheel.vx_;
@@ -541,10 +1563,9 @@ void FixpositionDriver::SendWheelspeedData(const std::vector<WheelSpeedData>& da
     }
 
     std::vector<uint8_t> message;
+    tx_buffer_pool_.Acquire(message);
     if (parser::fpb::FpbMakeMessage(message, parser::fpb::FP_B_MEASUREMENTS_MSGID, 0, payload, payload_size)) {
-        if (!Write(message.data(), message.size())) {
-            WARNING_THR(1000, "Failed sending FP_B-MEASUREMENTS message");
-        }
+        EnqueueTx(tx_queue_speed_, TX_QUEUE_CAPACITY_SPEED, std::move(message));
     } else {
         WARNING_THR(1000, "Failed making FP_B-MEASUREMENTS message");
     }
@@ -12,6 +12,11 @@
  */
 
 /* LIBC/STL */
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <deque>
+#include <mutex>
 #include <utility>
 
 /* EXTERNAL */
@@ -32,6 +37,35 @@ using namespace fpsdk::common::parser;
 
 // ---------------------------------------------------------------------------------------------------------------------
 
+const char* InternFrameId(const char* frame_id) {
+    // The frame IDs the sensor actually emits are all here and are served without taking the lock
+    static constexpr const char* KNOWN_FRAME_IDS[] = {
+        ODOMETRY_FRAME_ID, ODOMETRY_CHILD_FRAME_ID, ODOMSH_CHILD_FRAME_ID, ODOMENU_FRAME_ID, ENU_FRAME_ID,
+        IMU_FRAME_ID,      GNSS_FRAME_ID,           GNSS1_FRAME_ID,        GNSS2_FRAME_ID,   "FP_IMUH",
+        "FP_CAM",
+    };
+    for (const char* known : KNOWN_FRAME_IDS) {
+        if (std::strcmp(known, frame_id) == 0) {
+            return known;
+        }
+    }
+
+    // Unexpected (new?) frame IDs are interned on first use. This path is not hot: it runs at most once per distinct
+    // frame ID, after that the ID is found above resp. in the deque (which never invalidates the returned pointers).
+    static std::mutex mutex;
+    static std::deque<std::string> interned;
+    std::unique_lock<std::mutex> lock(mutex);
+    for (const auto& entry : interned) {
+        if (entry == frame_id) {
+            return entry.c_str();
+        }
+    }
+    interned.push_back(frame_id);
+    return interned.back().c_str();
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
 time::Time FpaGpsTimeToTime(const fpa::FpaGpsTime gps_time) {
     time::Time time;
     // Check time is available and check that it is in range
@@ -156,13 +190,18 @@ bool TfData::SetFromFpaTfPayload(const fpa::FpaTfPayload& payload) {
         ok = false;
     }
 
+    // The sensor sends the frame names without the "FP_" prefix. Compose the full ID on the stack and intern it, so
+    // that this path does no heap allocation.
+    char full_frame_id[64];
     if (payload.frame_a[0] != '\0') {
-        frame_id = "FP_" + std::string(payload.frame_a);
+        std::snprintf(full_frame_id, sizeof(full_frame_id), "FP_%s", payload.frame_a);
+        frame_id = InternFrameId(full_frame_id);
     } else {
         ok = false;
     }
     if (payload.frame_a[0] != '\0') {
-        child_frame_id = "FP_" + std::string(payload.frame_b);
+        std::snprintf(full_frame_id, sizeof(full_frame_id), "FP_%s", payload.frame_b);
+        child_frame_id = InternFrameId(full_frame_id);
     } else {
         ok = false;
     }
@@ -197,6 +236,7 @@ JumpDetector::JumpDetector() {
     prev_pos_.setZero();
     prev_cov_.setZero();
     pos_diff_.setZero();
+    warning_[0] = '\0';
 }
 
 bool JumpDetector::Check(const OdometryData& odometry_data) {
@@ -210,15 +250,21 @@ bool JumpDetector::Check(const OdometryData& odometry_data) {
         pos_diff_ = (prev_pos_ - odometry_data.pose.position).cwiseAbs();
         if ((pos_diff_[0] > prev_cov_(0, 0)) || (pos_diff_[1] > prev_cov_(1, 1)) || (pos_diff_[2] > prev_cov_(2, 2))) {
             jump_detected = true;
-            warning_ = string::Sprintf(
-                "Position jump detected! The change in position is greater than the estimated covariances. "
-                "Position difference: [ %.4f, %.4f, %.4f ], Covariances: [ %.4f, %.4f, %.4f ]",
-                pos_diff_[0], pos_diff_[1], pos_diff_[2], prev_cov_(0, 0), prev_cov_(1, 1), prev_cov_(2, 2));
+            std::snprintf(warning_, sizeof(warning_),
+                          "Position jump detected! The change in position is greater than the estimated covariances. "
+                          "Position difference: [ %.4f, %.4f, %.4f ], Covariances: [ %.4f, %.4f, %.4f ]",
+                          pos_diff_[0], pos_diff_[1], pos_diff_[2], prev_cov_(0, 0), prev_cov_(1, 1), prev_cov_(2, 2));
+            stats_.count_++;
+            stats_.max_displacement_ = std::max(stats_.max_displacement_, pos_diff_.maxCoeff());
+            if (stats_.count_ == 1) {
+                stats_.first_stamp_ = odometry_data.stamp;
+            }
+            stats_.last_stamp_ = odometry_data.stamp;
         }
     }
 
     curr_pos_ = odometry_data.pose.position;
-    curr_cov_ = odometry_data.pose.cov;
+    curr_cov_ = odometry_data.pose.cov.topLeftCorner<3, 3>();
     curr_stamp_ = odometry_data.stamp;
 
     return jump_detected;
@@ -226,6 +272,19 @@ bool JumpDetector::Check(const OdometryData& odometry_data) {
 
 // ---------------------------------------------------------------------------------------------------------------------
 
+fpb::FpbMeasurementsMeasLoc WheelspeedLocation(const char* location) {
+    // clang-format off
+    if      (std::strcmp(location, "RC") == 0) { return fpb::FpbMeasurementsMeasLoc::RC; }
+    else if (std::strcmp(location, "FR") == 0) { return fpb::FpbMeasurementsMeasLoc::FR; }
+    else if (std::strcmp(location, "FL") == 0) { return fpb::FpbMeasurementsMeasLoc::FL; }
+    else if (std::strcmp(location, "RR") == 0) { return fpb::FpbMeasurementsMeasLoc::RR; }
+    else if (std::strcmp(location, "RL") == 0) { return fpb::FpbMeasurementsMeasLoc::RL; }
+    else                                       { return fpb::FpbMeasurementsMeasLoc::UNSPECIFIED; }
+    // clang-format on
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
 NmeaEpochData::NmeaEpochData(const fpsdk::common::parser::fpa::FpaEpoch epoch) /* clang-format off */ :
     epoch_   { epoch }  // clang-format on
 {
@@ -234,7 +293,7 @@ NmeaEpochData::NmeaEpochData(const fpsdk::common::parser::fpa::FpaEpoch epoch) /
 
 // ---------------------------------------------------------------------------------------------------------------------
 
-NmeaEpochData NmeaEpochData::CompleteAndReset() {
+void NmeaEpochData::Complete() {
     // clang-format off
     switch (epoch_) {
         case fpa::FpaEpoch::UNSPECIFIED: break;
@@ -314,10 +373,23 @@ NmeaEpochData NmeaEpochData::CompleteAndReset() {
         cov_enu_(1, 1) = pdop_.value * pdop_.value;
         cov_enu_(2, 2) = pdop_.value * pdop_.value * 4.0;
     }
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
 
-    // Return data to user and reset ourselves back to empty
-    NmeaEpochData data(epoch_);
-    std::swap(data, *this);
+void NmeaEpochData::Reset() { *this = NmeaEpochData(epoch_); }
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+NmeaEpochCollector::NmeaEpochCollector(const fpsdk::common::parser::fpa::FpaEpoch epoch) /* clang-format off */ :
+    buffers_ { NmeaEpochData(epoch), NmeaEpochData(epoch) }  // clang-format on
+{}
+
+const NmeaEpochData& NmeaEpochCollector::CompleteAndSwap() {
+    NmeaEpochData& data = buffers_[active_];
+    data.Complete();
+    active_ ^= 1;
+    buffers_[active_].Reset();
     return data;
 }
 
@@ -358,20 +430,21 @@ void FusionEpochData::CollectFpaImubias(const fpsdk::common::parser::fpa::FpaImu
     fpa_imubias_avail_ = true;
 }
 
-FusionEpochData FusionEpochData::CompleteAndReset(const fpsdk::common::parser::fpa::FpaEoePayload& eoe) {
-    if (eoe.epoch != fpa::FpaEpoch::FUSION) {
-        return FusionEpochData();
-    }
-    fpa_eoe_avail_ = true;
-    fpa_eoe_ = eoe;
+void FusionEpochData::Reset() { *this = FusionEpochData(); }
+
+const FusionEpochData& FusionEpochCollector::CompleteAndSwap(const fpsdk::common::parser::fpa::FpaEoePayload& eoe) {
+    FusionEpochData& data = buffers_[active_];
+    data.fpa_eoe_avail_ = true;
+    data.fpa_eoe_ = eoe;
 
-    FusionEpochData data;
+    active_ ^= 1;
+    FusionEpochData& next = buffers_[active_];
+    next.Reset();
     // We'll keep the imubias as this updates with 1 Hz only (and isn't strictly part of the fusion epoch...)
-    if (fpa_imubias_avail_) {
-        data.CollectFpaImubias(fpa_imubias_);
+    if (data.fpa_imubias_avail_) {
+        next.CollectFpaImubias(data.fpa_imubias_);
     }
 
-    std::swap(data, *this);
     return data;
 }
 
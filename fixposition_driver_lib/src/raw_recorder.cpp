@@ -0,0 +1,125 @@
+/**
+ * \verbatim
+ * ___    ___
+ * \  \  /  /
+ *  \  \/  /   Copyright (c) Fixposition AG (www.fixposition.com) and contributors
+ *  /  /\  \   License: see the LICENSE file
+ * /__/  \__\
+ * \endverbatim
+ *
+ * @file
+ * @brief Memory-mapped raw stream recorder
+ */
+
+/* LIBC/STL */
+#include <cstring>
+
+/* EXTERNAL */
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <fpsdk_common/logging.hpp>
+#include <fpsdk_common/string.hpp>
+
+/* PACKAGE */
+#include "fixposition_driver_lib/raw_recorder.hpp"
+
+namespace fixposition {
+/* ****************************************************************************************************************** */
+
+using namespace fpsdk::common;
+
+RawRecorder::RawRecorder(const std::string& path, const std::size_t max_size) : path_{path}, max_size_{max_size} {}
+
+RawRecorder::~RawRecorder() { Close(); }
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+bool RawRecorder::Open() {
+    if (fd_ >= 0) {
+        return true;
+    }
+    seg_ix_ = 0;
+    if (!OpenSegment()) {
+        return false;
+    }
+    INFO("Recording raw stream to %s.{0,1} (max. %" PRIuMAX " bytes each)", path_.c_str(), max_size_);
+    return true;
+}
+
+void RawRecorder::Close() { CloseSegment(); }
+
+void RawRecorder::Record(const uint8_t* data, const std::size_t size) {
+    if ((map_ == nullptr) || (size > max_size_)) {
+        return;
+    }
+
+    // Rotate to the other segment when this one is full
+    if ((offset_ + size) > max_size_) {
+        CloseSegment();
+        seg_ix_ ^= 1;
+        stats_.num_rotations_++;
+        if (!OpenSegment()) {
+            return;
+        }
+    }
+
+    // Append into the mapping. This is just a memcpy into the page cache, the kernel writes the dirty pages back in
+    // the background.
+    std::memcpy(&map_[offset_], data, size);
+    offset_ += size;
+    stats_.num_bytes_ += size;
+}
+
+RawRecorder::Stats RawRecorder::GetStats() const { return stats_; }
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+bool RawRecorder::OpenSegment() {
+    const std::string seg_path = path_ + (seg_ix_ == 0 ? ".0" : ".1");
+    fd_ = open(seg_path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if (fd_ < 0) {
+        WARNING("Failed opening %s: %s", seg_path.c_str(), string::StrError(errno).c_str());
+        return false;
+    }
+
+    if (ftruncate(fd_, max_size_) != 0) {
+        WARNING("Failed allocating %s: %s", seg_path.c_str(), string::StrError(errno).c_str());
+        close(fd_);
+        fd_ = -1;
+        return false;
+    }
+
+    void* map = mmap(NULL, max_size_, PROT_READ | PROT_WRITE, MAP_SHARED, fd_, 0);
+    if (map == MAP_FAILED) {
+        WARNING("Failed mapping %s: %s", seg_path.c_str(), string::StrError(errno).c_str());
+        close(fd_);
+        fd_ = -1;
+        return false;
+    }
+
+    map_ = (uint8_t*)map;
+    offset_ = 0;
+    return true;
+}
+
+void RawRecorder::CloseSegment() {
+    if (map_ != nullptr) {
+        msync(map_, offset_, MS_ASYNC);
+        munmap(map_, max_size_);
+        map_ = nullptr;
+    }
+    if (fd_ >= 0) {
+        // Shrink the segment from its preallocated size to the data actually written
+        if (ftruncate(fd_, offset_) != 0) {
+            WARNING("Failed truncating recording: %s", string::StrError(errno).c_str());
+        }
+        close(fd_);
+        fd_ = -1;
+    }
+    offset_ = 0;
+}
+
+/* ****************************************************************************************************************** */
+}  // namespace fixposition
@@ -0,0 +1,146 @@
+/**
+ * \verbatim
+ * ___    ___
+ * \  \  /  /
+ *  \  \/  /   Copyright (c) Fixposition AG (www.fixposition.com) and contributors
+ *  /  /\  \   License: see the LICENSE file
+ * /__/  \__\
+ * \endverbatim
+ *
+ * @file
+ * @brief Shared-memory output of the latest navigation state
+ */
+
+/* LIBC/STL */
+#include <cerrno>
+#include <cstring>
+
+/* EXTERNAL */
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <fpsdk_common/logging.hpp>
+#include <fpsdk_common/string.hpp>
+
+/* PACKAGE */
+#include "fixposition_driver_lib/shm_output.hpp"
+
+namespace fixposition {
+/* ****************************************************************************************************************** */
+
+using namespace fpsdk::common;
+
+ShmOutput::ShmOutput(const std::string& name) : name_{(name.substr(0, 1) == "/" ? name : "/" + name)} {}
+
+ShmOutput::~ShmOutput() { Close(); }
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+bool ShmOutput::Open() {
+    fd_ = shm_open(name_.c_str(), O_CREAT | O_RDWR, 0644);
+    if (fd_ < 0) {
+        WARNING("Failed opening shared-memory output %s: %s", name_.c_str(), string::StrError(errno).c_str());
+        return false;
+    }
+    if (ftruncate(fd_, sizeof(ShmLayout)) != 0) {
+        WARNING("Failed sizing shared-memory output %s: %s", name_.c_str(), string::StrError(errno).c_str());
+        Close();
+        return false;
+    }
+    void* mem = mmap(NULL, sizeof(ShmLayout), PROT_READ | PROT_WRITE, MAP_SHARED, fd_, 0);
+    if (mem == MAP_FAILED) {
+        WARNING("Failed mapping shared-memory output %s: %s", name_.c_str(), string::StrError(errno).c_str());
+        Close();
+        return false;
+    }
+    layout_ = static_cast<ShmLayout*>(mem);
+
+    // Initialise (or re-initialise, e.g. after a layout change) the segment. The magic is written last with release
+    // semantics, so a reader that sees a valid magic also sees initialised records.
+    if ((layout_->magic_ != ShmLayout::MAGIC) || (layout_->version_ != ShmLayout::VERSION)) {
+        std::memset(static_cast<void*>(layout_), 0, sizeof(ShmLayout));
+        layout_->version_ = ShmLayout::VERSION;
+        std::atomic_thread_fence(std::memory_order_release);
+        layout_->magic_ = ShmLayout::MAGIC;
+    }
+
+    INFO("Shared-memory output at /dev/shm%s", name_.c_str());
+    return true;
+}
+
+void ShmOutput::Close() {
+    if (layout_ != nullptr) {
+        munmap(static_cast<void*>(layout_), sizeof(ShmLayout));
+        layout_ = nullptr;
+    }
+    if (fd_ >= 0) {
+        close(fd_);
+        fd_ = -1;
+    }
+    // The segment is deliberately not shm_unlink()ed: readers may still be attached, and the last state remains
+    // available for late-coming readers until the segment is reused or removed
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+template <typename T>
+void ShmOutput::WriteRecord(ShmRecord<T>& record, const T& data) {
+    // Seqlock write side (kernel-style): bump the counter to odd, store the payload, bump to even. The fence resp.
+    // the release store keep the payload stores between the two counter stores, so a reader seeing the same even
+    // counter before and after its copy has a consistent snapshot (see ShmReadRecord()).
+    const uint32_t seq = record.seq_.load(std::memory_order_relaxed);
+    record.seq_.store(seq + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    record.data_ = data;
+    record.seq_.store(seq + 2, std::memory_order_release);
+}
+
+void ShmOutput::UpdateOdometry(const OdometryData& data) {
+    if (layout_ == nullptr) {
+        return;
+    }
+    ShmOdometry shm;
+    std::memset(&shm, 0, sizeof(shm));
+    shm.stamp_ns_ = data.stamp.GetNSec();
+    shm.position_[0] = data.pose.position.x();
+    shm.position_[1] = data.pose.position.y();
+    shm.position_[2] = data.pose.position.z();
+    shm.orientation_[0] = data.pose.orientation.w();
+    shm.orientation_[1] = data.pose.orientation.x();
+    shm.orientation_[2] = data.pose.orientation.y();
+    shm.orientation_[3] = data.pose.orientation.z();
+    shm.velocity_[0] = data.twist.linear.x();
+    shm.velocity_[1] = data.twist.linear.y();
+    shm.velocity_[2] = data.twist.linear.z();
+    shm.angular_velocity_[0] = data.twist.angular.x();
+    shm.angular_velocity_[1] = data.twist.angular.y();
+    shm.angular_velocity_[2] = data.twist.angular.z();
+    shm.valid_ = (data.valid ? 1 : 0);
+    WriteRecord(layout_->odometry_, shm);
+}
+
+void ShmOutput::UpdateImu(const fpsdk::common::parser::fpa::FpaRawimuPayload& payload) {
+    if (layout_ == nullptr) {
+        return;
+    }
+    ShmImu shm;
+    std::memset(&shm, 0, sizeof(shm));
+    shm.stamp_ns_ = FpaGpsTimeToTime(payload.gps_time).GetNSec();
+    if (payload.acc.valid) {
+        shm.acc_[0] = payload.acc.values[0];
+        shm.acc_[1] = payload.acc.values[1];
+        shm.acc_[2] = payload.acc.values[2];
+    }
+    if (payload.rot.valid) {
+        shm.rot_[0] = payload.rot.values[0];
+        shm.rot_[1] = payload.rot.values[1];
+        shm.rot_[2] = payload.rot.values[2];
+    }
+    shm.valid_ = ((payload.acc.valid && payload.rot.valid) ? 1 : 0);
+    WriteRecord(layout_->imu_, shm);
+}
+
+/* ****************************************************************************************************************** */
+}  // namespace fixposition
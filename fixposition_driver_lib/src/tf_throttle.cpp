@@ -0,0 +1,103 @@
+/**
+ * \verbatim
+ * ___    ___
+ * \  \  /  /
+ *  \  \/  /   Copyright (c) Fixposition AG (www.fixposition.com) and contributors
+ *  /  /\  \   License: see the LICENSE file
+ * /__/  \__\
+ * \endverbatim
+ *
+ * @file
+ * @brief TF output change detection and rate decimation
+ */
+
+/* LIBC/STL */
+#include <chrono>
+
+/* EXTERNAL */
+
+/* PACKAGE */
+#include "fixposition_driver_lib/tf_throttle.hpp"
+
+namespace fixposition {
+/* ****************************************************************************************************************** */
+
+// Keepalive interval for unchanged transforms, so that downstream tf2 buffers (default 10s retention) never expire
+// a transform we suppressed
+static constexpr uint64_t KEEPALIVE_NS = 1000000000;
+
+TfThrottle::TfThrottle(const double epsilon_trans, const double epsilon_rot, const double max_rate) /* clang-format off */ :
+    epsilon_trans_  { epsilon_trans },
+    epsilon_rot_    { epsilon_rot },
+    interval_ns_    { max_rate > 0.0 ? (uint64_t)(1e9 / max_rate) : 0 },
+    enabled_        { (epsilon_trans > 0.0) || (epsilon_rot > 0.0) || (max_rate > 0.0) }  // clang-format on
+{}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+static uint64_t NowNanos() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+bool TfThrottle::Accept(const char* frame_id, const char* child_frame_id, const Eigen::Vector3d& translation,
+                        const Eigen::Quaterniond& rotation) {
+    if (!enabled_) {
+        stats_.num_sent_.fetch_add(1, std::memory_order_relaxed);
+        return true;
+    }
+
+    // Find the transform's entry. The frame IDs are interned, so pointer comparison suffices, and there are only a
+    // handful of transforms, so a linear scan beats any hashing.
+    Entry* entry = nullptr;
+    for (auto& cand : entries_) {
+        if ((cand.frame_id_ == frame_id) && (cand.child_frame_id_ == child_frame_id)) {
+            entry = &cand;
+            break;
+        }
+    }
+
+    const uint64_t now = NowNanos();
+
+    // First sighting: always send
+    if (entry == nullptr) {
+        entries_.push_back({frame_id, child_frame_id, translation, rotation, now});
+        stats_.num_sent_.fetch_add(1, std::memory_order_relaxed);
+        return true;
+    }
+
+    const uint64_t age = now - entry->last_ns_;
+
+    // Change detection: suppress if the transform moved less than the epsilons since the last accepted send. Without
+    // configured epsilons every transform counts as changed.
+    bool changed = true;
+    if ((epsilon_trans_ > 0.0) || (epsilon_rot_ > 0.0)) {
+        changed = ((epsilon_trans_ > 0.0) && ((translation - entry->translation_).norm() >= epsilon_trans_)) ||
+                  ((epsilon_rot_ > 0.0) && (rotation.angularDistance(entry->rotation_) >= epsilon_rot_));
+    }
+
+    // Decimation: suppress also changed transforms while within the minimum send interval
+    const bool due = (interval_ns_ == 0) || (age >= interval_ns_);
+
+    // Keepalive: re-send long-unchanged transforms regardless
+    if ((changed && due) || (age >= KEEPALIVE_NS)) {
+        entry->translation_ = translation;
+        entry->rotation_ = rotation;
+        entry->last_ns_ = now;
+        stats_.num_sent_.fetch_add(1, std::memory_order_relaxed);
+        return true;
+    }
+
+    stats_.num_suppressed_.fetch_add(1, std::memory_order_relaxed);
+    return false;
+}
+
+TfThrottle::Stats TfThrottle::GetStats() const {
+    Stats stats;
+    stats.num_sent_ = stats_.num_sent_.load(std::memory_order_relaxed);
+    stats.num_suppressed_ = stats_.num_suppressed_.load(std::memory_order_relaxed);
+    return stats;
+}
+
+/* ****************************************************************************************************************** */
+}  // namespace fixposition
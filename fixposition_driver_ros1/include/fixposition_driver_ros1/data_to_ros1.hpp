@@ -21,6 +21,7 @@
 /* EXTERNAL */
 #include <fixposition_driver_lib/fixposition_driver.hpp>
 #include <fixposition_driver_lib/helper.hpp>
+#include <fixposition_driver_lib/tf_throttle.hpp>
 #include <fpsdk_common/parser/fpa.hpp>
 #include <fpsdk_common/parser/novb.hpp>
 #include <fpsdk_ros1/ext/ros.hpp>
@@ -74,6 +75,8 @@ void PublishNmeaEpochData(const NmeaEpochData& data, ros::Publisher& pub);
 void PublishOdometryData(const OdometryData& data, ros::Publisher& pub);
 void PublishJumpWarning(const JumpDetector& jump_detector, ros::Publisher& pub);
 void PublishFusionEpochData(const FusionEpochData& data, ros::Publisher& pub);
+void PublishDriverStats(const FixpositionDriver::Stats& stats, const TfThrottle::Stats& tf_stats,
+                        const ros::Time& stamp, ros::Publisher& pub);
 
 /* ****************************************************************************************************************** */
 }  // namespace fixposition
@@ -17,9 +17,11 @@
 /* LIBC/STL */
 #include <memory>
 #include <mutex>
+#include <vector>
 
 /* EXTERNAL */
 #include <fixposition_driver_lib/helper.hpp>
+#include <fixposition_driver_lib/tf_throttle.hpp>
 #include <fpsdk_ros1/ext/ros.hpp>
 
 /* PACKAGE */
@@ -106,8 +108,10 @@ class FixpositionDriverNode {
     ros::Publisher navsatfix_gnss2_pub_;  //!< GNSS2 position and status
     ros::Publisher nmea_epoch_pub_;       //!< NMEA epoch data
     // - Other
-    ros::Publisher jump_pub_;  //!< Jump warning topic
-    ros::Publisher raw_pub_;   //!< Raw messages topic
+    ros::Publisher jump_pub_;   //!< Jump warning topic
+    ros::Publisher raw_pub_;    //!< Raw messages topic
+    ros::Publisher stats_pub_;  //!< Driver statistics topic (low rate)
+    ros::Timer stats_timer_;    //!< Timer for publishing the driver statistics
 
     // ROS subscribers
     ros::Subscriber ws_sub_;       //!< Wheelspeed input subscriber
@@ -120,8 +124,13 @@ class FixpositionDriverNode {
 
     // State
     JumpDetector jump_detector_;
-    NmeaEpochData nmea_epoch_data_;      //!< NMEA epoch data collector
-    FusionEpochData fusion_epoch_data_;  //!< Fusion epoch data collector
+    TfThrottle tf_throttle_;  //!< TF output gating (see DriverParams::tf_* params)
+    //! Serialises the wheelspeed input callbacks: the node's AsyncSpinner resp. the nodelet manager run callbacks
+    //! concurrently, so ws_sub_ and ws_conv_sub_ can fire at the same time. Protects ws_data_.
+    std::mutex driver_mutex_;
+    std::vector<WheelSpeedData> ws_data_;  //!< Scratch for wheelspeed callbacks (protected by driver_mutex_)
+    NmeaEpochCollector nmea_epoch_data_;      //!< NMEA epoch data collector
+    FusionEpochCollector fusion_epoch_data_;  //!< Fusion epoch data collector
 
     // TFs
     struct Tfs {
@@ -130,6 +139,15 @@ class FixpositionDriverNode {
         std::unique_ptr<geometry_msgs::TransformStamped> poi_poish_;
         std::unique_ptr<geometry_msgs::TransformStamped> ecef_poish_;
         std::unique_ptr<geometry_msgs::TransformStamped> enu0_poi_;
+        // Cached ENU reference derived from ecef_enu0_ (see ProcessTfData()). The FP_ECEF -> FP_ENU0 transform is
+        // effectively static after startup, so the geodetic reference and the inverted rotation are refreshed only
+        // when it actually changes instead of being recomputed on every fusion epoch (see PublishNav2Tf()).
+        Eigen::Vector3d t_ecef_enu0_;     //!< ECEF position the cache was derived from
+        Eigen::Quaterniond q_ecef_enu0_;  //!< ECEF -> ENU0 rotation the cache was derived from
+        Eigen::Vector3d llh_enu0_;        //!< Geodetic (WGS84 LLH) position of the ENU reference
+        Eigen::Quaterniond q_enu0_ecef_;  //!< Inverted ECEF -> ENU0 rotation
+        bool ref_valid_ = false;          //!< Cache is populated
+        bool map_dirty_ = true;           //!< The (static) FP_ECEF -> map transform needs (re)publishing
     };
     Tfs tfs_;
 
@@ -30,6 +30,8 @@
 #include <fixposition_driver_msgs/Speed.h>
 // -Extras
 #include <fixposition_driver_msgs/CovWarn.h>
+#include <fixposition_driver_msgs/DriverLatency.h>
+#include <fixposition_driver_msgs/DriverStats.h>
 // - FP-A
 #include <fixposition_driver_msgs/FpaConsts.h>
 #include <fixposition_driver_msgs/FpaEoe.h>
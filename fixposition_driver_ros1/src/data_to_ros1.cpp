@@ -15,6 +15,8 @@
 #include <cmath>
 
 /* EXTERNAL */
+#include <boost/make_shared.hpp>
+
 #include <fixposition_driver_msgs/data_to_ros.hpp>
 #include <fpsdk_common/math.hpp>
 #include <fpsdk_common/time.hpp>
@@ -97,9 +99,10 @@ static void FpaOdometryToMsg(const fpa::FpaOdometryPayload& payload, fixposition
 
 void PublishFpaOdometry(const fpa::FpaOdometryPayload& payload, ros::Publisher& pub) {
     if (pub.getNumSubscribers() > 0) {
-        fixposition_driver_msgs::FpaOdometry msg;
+        auto msg_ptr = boost::make_shared<fixposition_driver_msgs::FpaOdometry>();
+        auto& msg = *msg_ptr;
         FpaOdometryToMsg(payload, msg);
-        pub.publish(msg);
+        pub.publish(msg_ptr);
     }
 }
 
@@ -112,9 +115,10 @@ static void FpaOdomenuToMsg(const fpa::FpaOdomenuPayload& payload, fixposition_d
 
 void PublishFpaOdomenu(const fpa::FpaOdomenuPayload& payload, ros::Publisher& pub) {
     if (pub.getNumSubscribers() > 0) {
-        fixposition_driver_msgs::FpaOdomenu msg;
+        auto msg_ptr = boost::make_shared<fixposition_driver_msgs::FpaOdomenu>();
+        auto& msg = *msg_ptr;
         FpaOdomenuToMsg(payload, msg);
-        pub.publish(msg);
+        pub.publish(msg_ptr);
     }
 }
 
@@ -127,9 +131,10 @@ static void FpaOdomshToMsg(const fpa::FpaOdomshPayload& payload, fixposition_dri
 
 void PublishFpaOdomsh(const fpa::FpaOdomshPayload& payload, ros::Publisher& pub) {
     if (pub.getNumSubscribers() > 0) {
-        fixposition_driver_msgs::FpaOdomsh msg;
+        auto msg_ptr = boost::make_shared<fixposition_driver_msgs::FpaOdomsh>();
+        auto& msg = *msg_ptr;
         FpaOdomshToMsg(payload, msg);
-        pub.publish(msg);
+        pub.publish(msg_ptr);
     }
 }
 
@@ -137,12 +142,13 @@ void PublishFpaOdomsh(const fpa::FpaOdomshPayload& payload, ros::Publisher& pub)
 
 void PublishFpaOdometryDataImu(const fpa::FpaOdometryPayload& payload, ros::Publisher& pub) {
     if (pub.getNumSubscribers() > 0) {
-        sensor_msgs::Imu msg;
+        auto msg_ptr = boost::make_shared<sensor_msgs::Imu>();
+        auto& msg = *msg_ptr;
         msg.header.stamp = ros1::utils::ConvTime(FpaGpsTimeToTime(payload.gps_time));
         msg.header.frame_id = ODOMETRY_FRAME_ID;
         FpaFloat3ToVector3(payload.acc, msg.linear_acceleration);
         FpaFloat3ToVector3(payload.rot, msg.angular_velocity);
-        pub.publish(msg);
+        pub.publish(msg_ptr);
     }
 }
 
@@ -150,7 +156,8 @@ void PublishFpaOdometryDataImu(const fpa::FpaOdometryPayload& payload, ros::Publ
 
 void PublishFpaOdometryDataNavSatFix(const fpa::FpaOdometryPayload& payload, ros::Publisher& pub) {
     if (pub.getNumSubscribers() > 0) {
-        sensor_msgs::NavSatFix msg;
+        auto msg_ptr = boost::make_shared<sensor_msgs::NavSatFix>();
+        auto& msg = *msg_ptr;
         msg.header.stamp = ros1::utils::ConvTime(FpaGpsTimeToTime(payload.gps_time));
         msg.header.frame_id = ODOMETRY_CHILD_FRAME_ID;
 
@@ -186,7 +193,7 @@ void PublishFpaOdometryDataNavSatFix(const fpa::FpaOdometryPayload& payload, ros
         }
 
         // Publish message
-        pub.publish(msg);
+        pub.publish(msg_ptr);
     }
 }
 
@@ -194,7 +201,8 @@ void PublishFpaOdometryDataNavSatFix(const fpa::FpaOdometryPayload& payload, ros
 
 void PublishFpaOdomenuVector3Stamped(const fpa::FpaOdomenuPayload& payload, ros::Publisher& pub) {
     if (pub.getNumSubscribers() > 0) {
-        geometry_msgs::Vector3Stamped msg;
+        auto msg_ptr = boost::make_shared<geometry_msgs::Vector3Stamped>();
+        auto& msg = *msg_ptr;
 
         msg.header.stamp = ros1::utils::ConvTime(FpaGpsTimeToTime(payload.gps_time));
         msg.header.frame_id = ENU_FRAME_ID;
@@ -208,7 +216,7 @@ void PublishFpaOdomenuVector3Stamped(const fpa::FpaOdomenuPayload& payload, ros:
         tf::vectorEigenToMsg(enu_euler, msg.vector);
 
         // Publish message
-        pub.publish(msg);
+        pub.publish(msg_ptr);
     }
 }
 
@@ -242,9 +250,10 @@ static void FpaOdomstatusToMsg(const fpa::FpaOdomstatusPayload& payload, fixposi
 
 void PublishFpaOdomstatus(const fpa::FpaOdomstatusPayload& payload, ros::Publisher& pub) {
     if (pub.getNumSubscribers() > 0) {
-        fixposition_driver_msgs::FpaOdomstatus msg;
+        auto msg_ptr = boost::make_shared<fixposition_driver_msgs::FpaOdomstatus>();
+        auto& msg = *msg_ptr;
         FpaOdomstatusToMsg(payload, msg);
-        pub.publish(msg);
+        pub.publish(msg_ptr);
     }
 }
 
@@ -252,7 +261,8 @@ void PublishFpaOdomstatus(const fpa::FpaOdomstatusPayload& payload, ros::Publish
 
 void PublishFpaLlh(const fpa::FpaLlhPayload& payload, ros::Publisher& pub) {
     if (pub.getNumSubscribers() > 0) {
-        fixposition_driver_msgs::FpaLlh msg;
+        auto msg_ptr = boost::make_shared<fixposition_driver_msgs::FpaLlh>();
+        auto& msg = *msg_ptr;
         msg.header.stamp = ros1::utils::ConvTime(FpaGpsTimeToTime(payload.gps_time));
         msg.header.frame_id = ODOMETRY_CHILD_FRAME_ID;
         FpaFloat3ToVector3(payload.llh, msg.position);
@@ -261,7 +271,7 @@ void PublishFpaLlh(const fpa::FpaLlhPayload& payload, ros::Publisher& pub) {
             cov_map = BuildCovMat3D(payload.cov_enu.values[0], payload.cov_enu.values[1], payload.cov_enu.values[2],
                                     payload.cov_enu.values[3], payload.cov_enu.values[4], payload.cov_enu.values[5]);
         }
-        pub.publish(msg);
+        pub.publish(msg_ptr);
     }
 }
 
@@ -269,10 +279,11 @@ void PublishFpaLlh(const fpa::FpaLlhPayload& payload, ros::Publisher& pub) {
 
 void PublishFpaEoe(const fpa::FpaEoePayload& payload, ros::Publisher& pub) {
     if (pub.getNumSubscribers() > 0) {
-        fixposition_driver_msgs::FpaEoe msg;
+        auto msg_ptr = boost::make_shared<fixposition_driver_msgs::FpaEoe>();
+        auto& msg = *msg_ptr;
         msg.header.stamp = ros1::utils::ConvTime(FpaGpsTimeToTime(payload.gps_time));
         msg.epoch = FpaEpochToMsg(msg, payload.epoch);
-        pub.publish(msg);
+        pub.publish(msg_ptr);
     }
 }
 
@@ -293,9 +304,10 @@ static void FpaImubiasToMsg(const fpa::FpaImubiasPayload& payload, fixposition_d
 
 void PublishFpaImubias(const fpa::FpaImubiasPayload& payload, ros::Publisher& pub) {
     if (pub.getNumSubscribers() > 0) {
-        fixposition_driver_msgs::FpaImubias msg;
+        auto msg_ptr = boost::make_shared<fixposition_driver_msgs::FpaImubias>();
+        auto& msg = *msg_ptr;
         FpaImubiasToMsg(payload, msg);
-        pub.publish(msg);
+        pub.publish(msg_ptr);
     }
 }
 
@@ -303,7 +315,8 @@ void PublishFpaImubias(const fpa::FpaImubiasPayload& payload, ros::Publisher& pu
 
 void PublishFpaGnssant(const fpa::FpaGnssantPayload& payload, ros::Publisher& pub) {
     if (pub.getNumSubscribers() > 0) {
-        fixposition_driver_msgs::FpaGnssant msg;
+        auto msg_ptr = boost::make_shared<fixposition_driver_msgs::FpaGnssant>();
+        auto& msg = *msg_ptr;
         msg.header.stamp = ros1::utils::ConvTime(FpaGpsTimeToTime(payload.gps_time));
         msg.gnss1_state = FpaAntStateToMsg(msg, payload.gnss1_state);
         msg.gnss1_power = FpaAntPowerToMsg(msg, payload.gnss1_power);
@@ -311,7 +324,7 @@ void PublishFpaGnssant(const fpa::FpaGnssantPayload& payload, ros::Publisher& pu
         msg.gnss2_state = FpaAntStateToMsg(msg, payload.gnss2_state);
         msg.gnss2_power = FpaAntPowerToMsg(msg, payload.gnss2_power);
         msg.gnss2_age = (payload.gnss2_age.valid ? payload.gnss2_age.value : -1);
-        pub.publish(msg);
+        pub.publish(msg_ptr);
     }
 }
 
@@ -319,7 +332,8 @@ void PublishFpaGnssant(const fpa::FpaGnssantPayload& payload, ros::Publisher& pu
 
 void PublishFpaGnsscorr(const fpa::FpaGnsscorrPayload& payload, ros::Publisher& pub) {
     if (pub.getNumSubscribers() > 0) {
-        fixposition_driver_msgs::FpaGnsscorr msg;
+        auto msg_ptr = boost::make_shared<fixposition_driver_msgs::FpaGnsscorr>();
+        auto& msg = *msg_ptr;
         msg.header.stamp = ros1::utils::ConvTime(FpaGpsTimeToTime(payload.gps_time));
         msg.gnss1_fix = FpaGnssFixToMsg(msg, payload.gnss1_fix);
         msg.gnss1_nsig_l1 = (payload.gnss1_nsig_l1.valid ? payload.gnss1_nsig_l1.value : -1);
@@ -334,14 +348,15 @@ void PublishFpaGnsscorr(const fpa::FpaGnsscorrPayload& payload, ros::Publisher&
         msg.sta_id = (payload.sta_id.valid ? payload.sta_id.value : -1);
         FpaFloat3ToVector3(payload.sta_llh, msg.sta_llh);
         msg.sta_dist = (payload.sta_dist.valid ? payload.sta_dist.value : -1);
-        pub.publish(msg);
+        pub.publish(msg_ptr);
     }
 }
 // ---------------------------------------------------------------------------------------------------------------------
 
 void PublishFpaTp(const fpa::FpaTpPayload& payload, ros::Publisher& pub) {
     if (pub.getNumSubscribers() > 0) {
-        fixposition_driver_msgs::FpaTp msg;
+        auto msg_ptr = boost::make_shared<fixposition_driver_msgs::FpaTp>();
+        auto& msg = *msg_ptr;
         msg.tp_name = payload.tp_name;
         msg.timebase = FpaTimebaseToMsg(msg, payload.timebase);
         msg.timeref = FpaTimerefToMsg(msg, payload.timeref);
@@ -349,7 +364,7 @@ void PublishFpaTp(const fpa::FpaTpPayload& payload, ros::Publisher& pub) {
         msg.tp_tow_sec = payload.tp_tow_sec.value;
         msg.tp_tow_psec = payload.tp_tow_psec.value;
         msg.gps_leaps = payload.gps_leaps.value;
-        pub.publish(msg);
+        pub.publish(msg_ptr);
     }
 }
 
@@ -357,10 +372,11 @@ void PublishFpaTp(const fpa::FpaTpPayload& payload, ros::Publisher& pub) {
 
 void PublishFpaText(const fpa::FpaTextPayload& payload, ros::Publisher& pub) {
     if (pub.getNumSubscribers() > 0) {
-        fixposition_driver_msgs::FpaText msg;
+        auto msg_ptr = boost::make_shared<fixposition_driver_msgs::FpaText>();
+        auto& msg = *msg_ptr;
         msg.level = FpaTextLevelToMsg(msg, payload.level);
         msg.text = payload.text;
-        pub.publish(msg);
+        pub.publish(msg_ptr);
     }
 }
 
@@ -384,17 +400,19 @@ static void FpaImuPayloadToRos(const SomeFpaImuPayload& payload, sensor_msgs::Im
 
 void PublishFpaRawimu(const fpa::FpaRawimuPayload& payload, ros::Publisher& pub) {
     if (pub.getNumSubscribers() > 0) {
-        sensor_msgs::Imu msg;
+        auto msg_ptr = boost::make_shared<sensor_msgs::Imu>();
+        auto& msg = *msg_ptr;
         FpaImuPayloadToRos(payload, msg);
-        pub.publish(msg);
+        pub.publish(msg_ptr);
     }
 }
 
 void PublishFpaCorrimu(const fpa::FpaCorrimuPayload& payload, ros::Publisher& pub) {
     if (pub.getNumSubscribers() > 0) {
-        sensor_msgs::Imu msg;
+        auto msg_ptr = boost::make_shared<sensor_msgs::Imu>();
+        auto& msg = *msg_ptr;
         FpaImuPayloadToRos(payload, msg);
-        pub.publish(msg);
+        pub.publish(msg_ptr);
     }
 }
 
@@ -409,7 +427,8 @@ bool PublishNovbBestgnsspos(const novb::NovbHeader* header, const novb::NovbBest
     }
     ros::Publisher pub = (header->Source() == novb::NovbMsgTypeSource::PRIMARY ? pub1 : pub2);
     if (pub.getNumSubscribers() > 0) {
-        sensor_msgs::NavSatFix msg;
+        auto msg_ptr = boost::make_shared<sensor_msgs::NavSatFix>();
+        auto& msg = *msg_ptr;
 
         time::Time stamp;
         if (stamp.SetWnoTow({header->long_header.gps_week, (double)header->long_header.gps_milliseconds * 1e-3,
@@ -436,7 +455,7 @@ bool PublishNovbBestgnsspos(const novb::NovbHeader* header, const novb::NovbBest
         Eigen::Array3d cov_diag(payload->lat_stdev, payload->lon_stdev, payload->hgt_stdev);
         cov_map = (cov_diag * cov_diag).matrix().asDiagonal();
 
-        pub.publish(msg);
+        pub.publish(msg_ptr);
     }
     return true;
 }
@@ -480,9 +499,10 @@ static void NovbInspvaxToMsg(const novb::NovbHeader* header, const novb::NovbIns
 
 bool PublishNovbInspvax(const novb::NovbHeader* header, const novb::NovbInspvax* payload, ros::Publisher& pub) {
     if (pub.getNumSubscribers() > 0) {
-        fixposition_driver_msgs::NovbInspvax msg;
+        auto msg_ptr = boost::make_shared<fixposition_driver_msgs::NovbInspvax>();
+        auto& msg = *msg_ptr;
         NovbInspvaxToMsg(header, payload, msg);
-        pub.publish(msg);
+        pub.publish(msg_ptr);
     }
     return true;
 }
@@ -491,7 +511,8 @@ bool PublishNovbInspvax(const novb::NovbHeader* header, const novb::NovbInspvax*
 
 void PublishNmeaGga(const fpsdk::common::parser::nmea::NmeaGgaPayload& payload, ros::Publisher& pub) {
     if (pub.getNumSubscribers() > 0) {
-        fixposition_driver_msgs::NmeaGga msg;
+        auto msg_ptr = boost::make_shared<fixposition_driver_msgs::NmeaGga>();
+        auto& msg = *msg_ptr;
         msg.talker = NmeaTalkerIdToMsg(msg, payload.talker);
         if (payload.time.valid) {
             msg.time_valid = true;
@@ -507,7 +528,7 @@ void PublishNmeaGga(const fpsdk::common::parser::nmea::NmeaGgaPayload& payload,
         msg.hdop = (payload.hdop.valid ? payload.hdop.value : NAN);
         msg.diff_age = (payload.diff_age.valid ? payload.diff_age.value : NAN);
         msg.diff_sta = payload.diff_sta.value;
-        pub.publish(msg);
+        pub.publish(msg_ptr);
     }
 }
 
@@ -515,7 +536,8 @@ void PublishNmeaGga(const fpsdk::common::parser::nmea::NmeaGgaPayload& payload,
 
 void PublishNmeaGll(const fpsdk::common::parser::nmea::NmeaGllPayload& payload, ros::Publisher& pub) {
     if (pub.getNumSubscribers() > 0) {
-        fixposition_driver_msgs::NmeaGll msg;
+        auto msg_ptr = boost::make_shared<fixposition_driver_msgs::NmeaGll>();
+        auto& msg = *msg_ptr;
         msg.talker = NmeaTalkerIdToMsg(msg, payload.talker);
         if (payload.time.valid) {
             msg.time_valid = true;
@@ -527,7 +549,7 @@ void PublishNmeaGll(const fpsdk::common::parser::nmea::NmeaGllPayload& payload,
         msg.longitude = (payload.ll.latlon_valid ? payload.ll.lon : NAN);
         msg.status = NmeaStatusGllRmcToMsg(msg, payload.status);
         msg.mode = NmeaModeGllVtgToMsg(msg, payload.mode);
-        pub.publish(msg);
+        pub.publish(msg_ptr);
     }
 }
 
@@ -535,7 +557,8 @@ void PublishNmeaGll(const fpsdk::common::parser::nmea::NmeaGllPayload& payload,
 
 void PublishNmeaGsa(const fpsdk::common::parser::nmea::NmeaGsaPayload& payload, ros::Publisher& pub) {
     if (pub.getNumSubscribers() > 0) {
-        fixposition_driver_msgs::NmeaGsa msg;
+        auto msg_ptr = boost::make_shared<fixposition_driver_msgs::NmeaGsa>();
+        auto& msg = *msg_ptr;
         msg.talker = NmeaTalkerIdToMsg(msg, payload.talker);
         msg.system = NmeaSystemIdToMsg(msg, payload.system);
         msg.opmode = NmeaOpModeGsaToMsg(msg, payload.opmode);
@@ -548,7 +571,7 @@ void PublishNmeaGsa(const fpsdk::common::parser::nmea::NmeaGsaPayload& payload,
         msg.pdop = (payload.pdop.valid ? payload.pdop.value : NAN);
         msg.hdop = (payload.hdop.valid ? payload.hdop.value : NAN);
         msg.vdop = (payload.vdop.valid ? payload.vdop.value : NAN);
-        pub.publish(msg);
+        pub.publish(msg_ptr);
     }
 }
 
@@ -556,7 +579,8 @@ void PublishNmeaGsa(const fpsdk::common::parser::nmea::NmeaGsaPayload& payload,
 
 void PublishNmeaGst(const fpsdk::common::parser::nmea::NmeaGstPayload& payload, ros::Publisher& pub) {
     if (pub.getNumSubscribers() > 0) {
-        fixposition_driver_msgs::NmeaGst msg;
+        auto msg_ptr = boost::make_shared<fixposition_driver_msgs::NmeaGst>();
+        auto& msg = *msg_ptr;
         msg.talker = NmeaTalkerIdToMsg(msg, payload.talker);
         if (payload.time.valid) {
             msg.time_valid = true;
@@ -571,14 +595,15 @@ void PublishNmeaGst(const fpsdk::common::parser::nmea::NmeaGstPayload& payload,
         msg.std_lat = (payload.std_lat.valid ? payload.std_lat.value : NAN);
         msg.std_lon = (payload.std_lon.valid ? payload.std_lon.value : NAN);
         msg.std_alt = (payload.std_alt.valid ? payload.std_alt.value : NAN);
-        pub.publish(msg);
+        pub.publish(msg_ptr);
     }
 }
 // ---------------------------------------------------------------------------------------------------------------------
 
 void PublishNmeaGsv(const fpsdk::common::parser::nmea::NmeaGsvPayload& payload, ros::Publisher& pub) {
     if (pub.getNumSubscribers() > 0) {
-        fixposition_driver_msgs::NmeaGsv msg;
+        auto msg_ptr = boost::make_shared<fixposition_driver_msgs::NmeaGsv>();
+        auto& msg = *msg_ptr;
         msg.talker = NmeaTalkerIdToMsg(msg, payload.talker);
         msg.talker = NmeaTalkerIdToMsg(msg, payload.talker);
         msg.system = NmeaSystemIdToMsg(msg, payload.system);
@@ -598,7 +623,7 @@ void PublishNmeaGsv(const fpsdk::common::parser::nmea::NmeaGsvPayload& payload,
                 msg.cno.push_back(cno.cno);
             }
         }
-        pub.publish(msg);
+        pub.publish(msg_ptr);
     }
 }
 
@@ -606,10 +631,11 @@ void PublishNmeaGsv(const fpsdk::common::parser::nmea::NmeaGsvPayload& payload,
 
 void PublishNmeaHdt(const fpsdk::common::parser::nmea::NmeaHdtPayload& payload, ros::Publisher& pub) {
     if (pub.getNumSubscribers() > 0) {
-        fixposition_driver_msgs::NmeaHdt msg;
+        auto msg_ptr = boost::make_shared<fixposition_driver_msgs::NmeaHdt>();
+        auto& msg = *msg_ptr;
         msg.talker = NmeaTalkerIdToMsg(msg, payload.talker);
         msg.heading = (payload.heading.valid ? payload.heading.value : NAN);
-        pub.publish(msg);
+        pub.publish(msg_ptr);
     }
 }
 
@@ -617,7 +643,8 @@ void PublishNmeaHdt(const fpsdk::common::parser::nmea::NmeaHdtPayload& payload,
 
 void PublishNmeaRmc(const fpsdk::common::parser::nmea::NmeaRmcPayload& payload, ros::Publisher& pub) {
     if (pub.getNumSubscribers() > 0) {
-        fixposition_driver_msgs::NmeaRmc msg;
+        auto msg_ptr = boost::make_shared<fixposition_driver_msgs::NmeaRmc>();
+        auto& msg = *msg_ptr;
         msg.talker = NmeaTalkerIdToMsg(msg, payload.talker);
         if (payload.date.valid) {
             msg.date_valid = true;
@@ -638,7 +665,7 @@ void PublishNmeaRmc(const fpsdk::common::parser::nmea::NmeaRmcPayload& payload,
         msg.longitude = (payload.llh.latlon_valid ? payload.llh.lon : NAN);
         msg.speed = (payload.speed.valid ? payload.speed.value : NAN);
         msg.course = (payload.course.valid ? payload.course.value : NAN);
-        pub.publish(msg);
+        pub.publish(msg_ptr);
     }
 }
 
@@ -646,14 +673,15 @@ void PublishNmeaRmc(const fpsdk::common::parser::nmea::NmeaRmcPayload& payload,
 
 void PublishNmeaVtg(const fpsdk::common::parser::nmea::NmeaVtgPayload& payload, ros::Publisher& pub) {
     if (pub.getNumSubscribers() > 0) {
-        fixposition_driver_msgs::NmeaVtg msg;
+        auto msg_ptr = boost::make_shared<fixposition_driver_msgs::NmeaVtg>();
+        auto& msg = *msg_ptr;
         msg.talker = NmeaTalkerIdToMsg(msg, payload.talker);
         msg.cogt = (payload.cogt.valid ? payload.cogt.value : NAN);
         msg.cogm = (payload.cogm.valid ? payload.cogm.value : NAN);
         msg.sogn = (payload.sogn.valid ? payload.sogn.value : NAN);
         msg.sogk = (payload.sogk.valid ? payload.sogk.value : NAN);
         msg.mode = NmeaModeGllVtgToMsg(msg, payload.mode);
-        pub.publish(msg);
+        pub.publish(msg_ptr);
     }
 }
 
@@ -661,7 +689,8 @@ void PublishNmeaVtg(const fpsdk::common::parser::nmea::NmeaVtgPayload& payload,
 
 void PublishNmeaZda(const fpsdk::common::parser::nmea::NmeaZdaPayload& payload, ros::Publisher& pub) {
     if (pub.getNumSubscribers() > 0) {
-        fixposition_driver_msgs::NmeaZda msg;
+        auto msg_ptr = boost::make_shared<fixposition_driver_msgs::NmeaZda>();
+        auto& msg = *msg_ptr;
         msg.talker = NmeaTalkerIdToMsg(msg, payload.talker);
         if (payload.date.valid) {
             msg.date_valid = true;
@@ -677,7 +706,7 @@ void PublishNmeaZda(const fpsdk::common::parser::nmea::NmeaZdaPayload& payload,
         }
         msg.local_hr = payload.local_hr.value;
         msg.local_min = payload.local_min.value;
-        pub.publish(msg);
+        pub.publish(msg_ptr);
     }
 }
 
@@ -685,14 +714,15 @@ void PublishNmeaZda(const fpsdk::common::parser::nmea::NmeaZdaPayload& payload,
 
 void PublishParserMsg(const fpsdk::common::parser::ParserMsg& msg, ros::Publisher& pub) {
     if (pub.getNumSubscribers() > 0) {
-        fixposition_driver_msgs::ParserMsg ros_msg;
+        auto ros_msg_ptr = boost::make_shared<fixposition_driver_msgs::ParserMsg>();
+        auto& ros_msg = *ros_msg_ptr;
         ros_msg.protocol = ParserProtocolToMsg(ros_msg, msg.proto_);
         ros_msg.data = msg.data_;
         ros_msg.name = msg.name_;
         ros_msg.seq = msg.seq_;
         msg.MakeInfo();
         ros_msg.info = msg.info_;
-        pub.publish(ros_msg);
+        pub.publish(ros_msg_ptr);
     }
 }
 
@@ -700,7 +730,8 @@ void PublishParserMsg(const fpsdk::common::parser::ParserMsg& msg, ros::Publishe
 
 void PublishNmeaEpochData(const NmeaEpochData& data, ros::Publisher& pub) {
     if (pub.getNumSubscribers() > 0) {
-        fixposition_driver_msgs::NmeaEpoch msg;
+        auto msg_ptr = boost::make_shared<fixposition_driver_msgs::NmeaEpoch>();
+        auto& msg = *msg_ptr;
         msg.header.stamp = ros1::utils::ConvTime(data.stamp_);
         msg.header.frame_id = data.frame_id_;
         if (data.date_.valid) {
@@ -766,7 +797,7 @@ void PublishNmeaEpochData(const NmeaEpochData& data, ros::Publisher& pub) {
         Eigen::Map<Eigen::Matrix<double, 3, 3>> cov_map = Eigen::Map<Eigen::Matrix<double, 3, 3>>(msg.cov_enu.data());
         cov_map = data.cov_enu_;
 
-        pub.publish(msg);
+        pub.publish(msg_ptr);
     }
 }
 
@@ -774,13 +805,14 @@ void PublishNmeaEpochData(const NmeaEpochData& data, ros::Publisher& pub) {
 
 void PublishOdometryData(const OdometryData& data, ros::Publisher& pub) {
     if (pub.getNumSubscribers() > 0) {
-        nav_msgs::Odometry msg;
+        auto msg_ptr = boost::make_shared<nav_msgs::Odometry>();
+        auto& msg = *msg_ptr;
         msg.header.stamp = ros1::utils::ConvTime(data.stamp);
         msg.header.frame_id = data.frame_id;
         msg.child_frame_id = data.child_frame_id;
         PoseWithCovDataToMsg(data.pose, msg.pose);
         TwistWithCovDataToMsg(data.twist, msg.twist);
-        pub.publish(msg);
+        pub.publish(msg_ptr);
     }
 }
 
@@ -788,13 +820,14 @@ void PublishOdometryData(const OdometryData& data, ros::Publisher& pub) {
 
 void PublishJumpWarning(const JumpDetector& jump_detector, ros::Publisher& pub) {
     if (pub.getNumSubscribers() > 0) {
-        fixposition_driver_msgs::CovWarn msg;
+        auto msg_ptr = boost::make_shared<fixposition_driver_msgs::CovWarn>();
+        auto& msg = *msg_ptr;
         msg.header.stamp = ros1::utils::ConvTime(jump_detector.curr_stamp_);
         tf::vectorEigenToMsg(jump_detector.pos_diff_, msg.jump);
         msg.covariance.x = jump_detector.prev_cov_(0, 0);
         msg.covariance.y = jump_detector.prev_cov_(1, 1);
         msg.covariance.z = jump_detector.prev_cov_(2, 2);
-        pub.publish(msg);
+        pub.publish(msg_ptr);
     }
 }
 
@@ -802,7 +835,8 @@ void PublishJumpWarning(const JumpDetector& jump_detector, ros::Publisher& pub)
 
 void PublishFusionEpochData(const FusionEpochData& data, ros::Publisher& pub) {
     if (pub.getNumSubscribers() > 0) {
-        fixposition_driver_msgs::FusionEpoch msg;
+        auto msg_ptr = boost::make_shared<fixposition_driver_msgs::FusionEpoch>();
+        auto& msg = *msg_ptr;
         msg.header.stamp = ros1::utils::ConvTime(FpaGpsTimeToTime(data.fpa_eoe_.gps_time));
         if (data.fpa_odometry_avail_) {
             msg.fpa_odometry_avail = true;
@@ -828,7 +862,43 @@ void PublishFusionEpochData(const FusionEpochData& data, ros::Publisher& pub) {
             msg.fpa_imubias_avail = true;
             FpaImubiasToMsg(data.fpa_imubias_, msg.fpa_imubias);
         }
-        pub.publish(msg);
+        pub.publish(msg_ptr);
+    }
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+static void LatencyStatsToMsg(const LatencyHistogram::Stats& stats, fixposition_driver_msgs::DriverLatency& msg) {
+    msg.count = stats.count_;
+    msg.p50 = stats.p50_;
+    msg.p99 = stats.p99_;
+    msg.max = stats.max_;
+}
+
+void PublishDriverStats(const FixpositionDriver::Stats& stats, const TfThrottle::Stats& tf_stats,
+                        const ros::Time& stamp, ros::Publisher& pub) {
+    if (pub.getNumSubscribers() > 0) {
+        auto msg_ptr = boost::make_shared<fixposition_driver_msgs::DriverStats>();
+        auto& msg = *msg_ptr;
+        msg.header.stamp = stamp;
+        msg.read_num_reads = stats.read_.num_reads_;
+        msg.read_num_bytes = stats.read_.num_bytes_;
+        msg.read_max_read = stats.read_.max_read_;
+        msg.queue_depth = stats.queue_.depth_;
+        msg.queue_watermark = stats.queue_.high_watermark_;
+        msg.queue_dropped = stats.queue_.num_dropped_;
+        msg.queue_skipped = stats.queue_.num_skipped_;
+        msg.queue_decimated = stats.queue_.num_decimated_;
+        msg.tf_num_sent = tf_stats.num_sent_;
+        msg.tf_num_suppressed = tf_stats.num_suppressed_;
+        msg.tx_num_sent = stats.tx_.num_sent_;
+        msg.tx_num_dropped = stats.tx_.num_dropped_;
+        msg.tx_num_failed = stats.tx_.num_failed_;
+        LatencyStatsToMsg(stats.latency_.parse_, msg.parse_latency);
+        LatencyStatsToMsg(stats.latency_.dispatch_fpa_, msg.fpa_latency);
+        LatencyStatsToMsg(stats.latency_.dispatch_nmea_, msg.nmea_latency);
+        LatencyStatsToMsg(stats.latency_.dispatch_novb_, msg.novb_latency);
+        pub.publish(msg_ptr);
     }
 }
 
@@ -0,0 +1,99 @@
+/**
+ * \verbatim
+ * ___    ___
+ * \  \  /  /
+ *  \  \/  /   Copyright (c) Fixposition AG (www.fixposition.com) and contributors
+ *  /  /\  \   License: see the LICENSE file
+ * /__/  \__\
+ * \endverbatim
+ *
+ * @file
+ * @brief Fixposition driver node for ROS1: main() for the standalone node (see fixposition_driver_nodelet.cpp for
+ *        the nodelet)
+ */
+
+/* LIBC/STL */
+#include <cstdlib>
+#include <memory>
+
+/* EXTERNAL */
+#include <fpsdk_common/app.hpp>
+#include <fpsdk_common/logging.hpp>
+#include <fpsdk_ros1/utils.hpp>
+
+/* PACKAGE */
+#include "fixposition_driver_ros1/fixposition_driver_node.hpp"
+
+using namespace fixposition;
+
+int main(int argc, char** argv) {
+#ifndef NDEBUG
+    fpsdk::common::app::StacktraceHelper stacktrace;
+    WARNING("***** Running debug build *****");
+#endif
+
+    bool ok = true;
+
+    // Initialise ROS, create node handle
+    ros::init(argc, argv, "fixposition_driver");
+    ros::NodeHandle node_handle("~");
+
+    // Redirect Fixposition SDK logging to ROS console
+    fpsdk::ros1::utils::RedirectLoggingToRosConsole();
+
+    // Say hello
+    HelloWorld();
+
+    // Load parameters
+    ROS_INFO("Loading parameters...");
+    DriverParams driver_params;
+    if (!LoadParamsFromRos1("~", driver_params)) {
+        ROS_ERROR("Failed loading sensor params");
+        ok = false;
+    }
+
+    // Handle CTRL-C / SIGINT ourselves
+    fpsdk::common::app::SigIntHelper sigint;
+
+    // Start node
+    std::unique_ptr<FixpositionDriverNode> node;
+    if (ok) {
+        try {
+            node = std::make_unique<FixpositionDriverNode>(driver_params, node_handle);
+        } catch (const std::exception& ex) {
+            ROS_ERROR("Failed creating node: %s", ex.what());
+            ok = false;
+        }
+    }
+    if (ok) {
+        ROS_INFO("Starting node...");
+        if (node->StartNode()) {
+            ROS_INFO("main() spinning...");
+            // Use multiple spinner threads. Callback execute in one of them.
+            ros::AsyncSpinner spinner(4);
+            spinner.start();
+            sigint.WaitAbort();
+            spinner.stop();
+            ROS_INFO("main() stopping");
+        } else {
+            ROS_ERROR("Failed starting node");
+            ok = false;
+        }
+        node->StopNode();
+        node.reset();
+    }
+
+    // Are we happy?
+    if (ok) {
+        ROS_INFO("Done");
+    } else {
+        ROS_FATAL("Ouch!");
+    }
+
+    // Shutdown ROS
+    ros::shutdown();
+
+    exit(ok ? EXIT_SUCCESS : EXIT_FAILURE);
+}
+
+/* ****************************************************************************************************************** */
@@ -17,9 +17,12 @@
 #include <functional>
 #include <memory>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 /* EXTERNAL */
+#include <boost/make_shared.hpp>
+
 #include <fpsdk_common/app.hpp>
 #include <fpsdk_common/logging.hpp>
 #include <fpsdk_common/parser/fpa.hpp>
@@ -43,6 +46,7 @@ FixpositionDriverNode::FixpositionDriverNode(const DriverParams& params, ros::No
     nh_                { nh },
     params_            { params },
     driver_            { params_ },
+    tf_throttle_       { params_.tf_epsilon_trans_, params_.tf_epsilon_rot_, params_.tf_max_rate_ },
     nmea_epoch_data_   { params_.nmea_epoch_ }  // clang-format on
 {}
 
@@ -76,8 +80,7 @@ bool FixpositionDriverNode::StartNode() {
         _PUB(odometry_ecef_pub_, nav_msgs::Odometry, output_ns + "/odometry_ecef", 5);
         _PUB(odometry_llh_pub_, sensor_msgs::NavSatFix, output_ns + "/odometry_llh", 5);
         _PUB(poiimu_pub_, sensor_msgs::Imu, output_ns + "/poiimu", 5);
-        driver_.AddFpaObserver(fpa::FpaOdometryPayload::MSG_NAME, [this](const fpa::FpaPayload& payload) {
-            auto odometry_payload = dynamic_cast<const fpa::FpaOdometryPayload&>(payload);
+        driver_.AddFpaObserver<fpa::FpaOdometryPayload>([this](const fpa::FpaOdometryPayload& odometry_payload) {
             PublishFpaOdometry(odometry_payload, fpa_odometry_pub_);
             PublishFpaOdometryDataImu(odometry_payload, poiimu_pub_);
             PublishFpaOdometryDataNavSatFix(odometry_payload, odometry_llh_pub_);
@@ -85,7 +88,7 @@ bool FixpositionDriverNode::StartNode() {
             odometry_data.SetFromFpaOdomPayload(odometry_payload);
             PublishOdometryData(odometry_data, odometry_ecef_pub_);
             ProcessOdometryData(odometry_data);
-            fusion_epoch_data_.CollectFpaOdometry(odometry_payload);
+            fusion_epoch_data_.Active().CollectFpaOdometry(odometry_payload);
         });
     }
 
@@ -93,14 +96,13 @@ bool FixpositionDriverNode::StartNode() {
     if (params_.MessageEnabled(fpa::FpaOdomshPayload::MSG_NAME)) {
         _PUB(fpa_odomsh_pub_, fixposition_driver_msgs::FpaOdomsh, output_ns + "/fpa/odomsh", 5);
         _PUB(odometry_smooth_pub_, nav_msgs::Odometry, output_ns + "/odometry_smooth", 5);
-        driver_.AddFpaObserver(fpa::FpaOdomshPayload::MSG_NAME, [this](const fpa::FpaPayload& payload) {
-            auto odomsh_payload = dynamic_cast<const fpa::FpaOdomshPayload&>(payload);
+        driver_.AddFpaObserver<fpa::FpaOdomshPayload>([this](const fpa::FpaOdomshPayload& odomsh_payload) {
             PublishFpaOdomsh(odomsh_payload, fpa_odomsh_pub_);
             OdometryData odometry_data;
             odometry_data.SetFromFpaOdomPayload(odomsh_payload);
             PublishOdometryData(odometry_data, odometry_smooth_pub_);
             ProcessOdometryData(odometry_data);
-            fusion_epoch_data_.CollectFpaOdomsh(odomsh_payload);
+            fusion_epoch_data_.Active().CollectFpaOdomsh(odomsh_payload);
         });
     }
 
@@ -109,37 +111,34 @@ bool FixpositionDriverNode::StartNode() {
         _PUB(fpa_odomenu_pub_, fixposition_driver_msgs::FpaOdomenu, output_ns + "/fpa/odomenu", 5);
         _PUB(odometry_enu_pub_, nav_msgs::Odometry, output_ns + "/odometry_enu", 5);
         _PUB(eul_pub_, geometry_msgs::Vector3Stamped, output_ns + "/ypr", 5);
-        driver_.AddFpaObserver(fpa::FpaOdomenuPayload::MSG_NAME, [this](const fpa::FpaPayload& payload) {
-            auto odomenu_payload = dynamic_cast<const fpa::FpaOdomenuPayload&>(payload);
+        driver_.AddFpaObserver<fpa::FpaOdomenuPayload>([this](const fpa::FpaOdomenuPayload& odomenu_payload) {
             PublishFpaOdomenu(odomenu_payload, fpa_odomenu_pub_);
             PublishFpaOdomenuVector3Stamped(odomenu_payload, eul_pub_);
             OdometryData odometry_data;
             odometry_data.SetFromFpaOdomPayload(odomenu_payload);
             PublishOdometryData(odometry_data, odometry_enu_pub_);
             ProcessOdometryData(odometry_data);
-            fusion_epoch_data_.CollectFpaOdomenu(odomenu_payload);
+            fusion_epoch_data_.Active().CollectFpaOdomenu(odomenu_payload);
         });
     }
 
     // FP_A-ODOMSTATUS
     if (params_.MessageEnabled(fpa::FpaOdomstatusPayload::MSG_NAME)) {
         _PUB(fpa_odomstatus_pub_, fixposition_driver_msgs::FpaOdomstatus, output_ns + "/fpa/odomstatus", 5);
-        driver_.AddFpaObserver(fpa::FpaOdomstatusPayload::MSG_NAME, [this](const fpa::FpaPayload& payload) {
-            auto odomstatus_payload = dynamic_cast<const fpa::FpaOdomstatusPayload&>(payload);
+        driver_.AddFpaObserver<fpa::FpaOdomstatusPayload>([this](const fpa::FpaOdomstatusPayload& odomstatus_payload) {
             PublishFpaOdomstatus(odomstatus_payload, fpa_odomstatus_pub_);
-            fusion_epoch_data_.CollectFpaOdomstatus(odomstatus_payload);
+            fusion_epoch_data_.Active().CollectFpaOdomstatus(odomstatus_payload);
         });
     }
 
     // FP_A-EOE
     if (params_.MessageEnabled(fpa::FpaEoePayload::MSG_NAME)) {
         _PUB(fpa_eoe_pub_, fixposition_driver_msgs::FpaEoe, output_ns + "/fpa/eoe", 5);
-        driver_.AddFpaObserver(fpa::FpaEoePayload::MSG_NAME, [this](const fpa::FpaPayload& payload) {
-            auto eoe_payload = dynamic_cast<const fpa::FpaEoePayload&>(payload);
+        driver_.AddFpaObserver<fpa::FpaEoePayload>([this](const fpa::FpaEoePayload& eoe_payload) {
             PublishFpaEoe(eoe_payload, fpa_eoe_pub_);
             if (eoe_payload.epoch == fpa::FpaEpoch::FUSION) {
                 // Fusion epoch
-                PublishFusionEpochData(fusion_epoch_data_.CompleteAndReset(eoe_payload), fusion_epoch_pub_);
+                PublishFusionEpochData(fusion_epoch_data_.CompleteAndSwap(eoe_payload), fusion_epoch_pub_);
                 // Generate Nav2 TF tree
                 if (params_.nav2_mode_) {
                     PublishNav2Tf();
@@ -148,7 +147,7 @@ bool FixpositionDriverNode::StartNode() {
 
             // NMEA epoch (which can be FUSION, too)
             if (params_.nmea_epoch_ == eoe_payload.epoch) {
-                PublishNmeaEpochData(nmea_epoch_data_.CompleteAndReset(), nmea_epoch_pub_);
+                PublishNmeaEpochData(nmea_epoch_data_.CompleteAndSwap(), nmea_epoch_pub_);
             }
         });
     }
@@ -156,9 +155,9 @@ bool FixpositionDriverNode::StartNode() {
     // FP_A-TF
     if (params_.MessageEnabled(fpa::FpaTfPayload::MSG_NAME)) {
         _PUB(eul_imu_pub_, geometry_msgs::Vector3Stamped, output_ns + "/imu_ypr", 5);
-        driver_.AddFpaObserver(fpa::FpaTfPayload::MSG_NAME, [this](const fpa::FpaPayload& payload) {
+        driver_.AddFpaObserver<fpa::FpaTfPayload>([this](const fpa::FpaTfPayload& payload) {
             TfData tf;
-            tf.SetFromFpaTfPayload(dynamic_cast<const fpa::FpaTfPayload&>(payload));
+            tf.SetFromFpaTfPayload(payload);
             ProcessTfData(tf);
         });
     }
@@ -166,66 +165,65 @@ bool FixpositionDriverNode::StartNode() {
     // FP_A-LLH
     if (params_.MessageEnabled(fpa::FpaLlhPayload::MSG_NAME)) {
         _PUB(fpa_llh_pub_, fixposition_driver_msgs::FpaLlh, output_ns + "/fpa/llh", 5);
-        driver_.AddFpaObserver(fpa::FpaLlhPayload::MSG_NAME, [this](const fpa::FpaPayload& payload) {
-            PublishFpaLlh(dynamic_cast<const fpa::FpaLlhPayload&>(payload), fpa_llh_pub_);
+        driver_.AddFpaObserver<fpa::FpaLlhPayload>([this](const fpa::FpaLlhPayload& payload) {
+            PublishFpaLlh(payload, fpa_llh_pub_);
         });
     }
 
     // FP_A-GNSSANT
     if (params_.MessageEnabled(fpa::FpaGnssantPayload::MSG_NAME)) {
         _PUB(fpa_gnssant_pub_, fixposition_driver_msgs::FpaGnssant, output_ns + "/fpa/gnssant", 5);
-        driver_.AddFpaObserver(fpa::FpaGnssantPayload::MSG_NAME, [this](const fpa::FpaPayload& payload) {
-            PublishFpaGnssant(dynamic_cast<const fpa::FpaGnssantPayload&>(payload), fpa_gnssant_pub_);
+        driver_.AddFpaObserver<fpa::FpaGnssantPayload>([this](const fpa::FpaGnssantPayload& payload) {
+            PublishFpaGnssant(payload, fpa_gnssant_pub_);
         });
     }
 
     // FP_A-GNSSCORR
     if (params_.MessageEnabled(fpa::FpaGnsscorrPayload::MSG_NAME)) {
         _PUB(fpa_gnsscorr_pub_, fixposition_driver_msgs::FpaGnsscorr, output_ns + "/fpa/gnsscorr", 5);
-        driver_.AddFpaObserver(fpa::FpaGnsscorrPayload::MSG_NAME, [this](const fpa::FpaPayload& payload) {
-            PublishFpaGnsscorr(dynamic_cast<const fpa::FpaGnsscorrPayload&>(payload), fpa_gnsscorr_pub_);
+        driver_.AddFpaObserver<fpa::FpaGnsscorrPayload>([this](const fpa::FpaGnsscorrPayload& payload) {
+            PublishFpaGnsscorr(payload, fpa_gnsscorr_pub_);
         });
     }
 
     // FP_A-IMUBIAS
     if (params_.MessageEnabled(fpa::FpaImubiasPayload::MSG_NAME)) {
         _PUB(fpa_imubias_pub_, fixposition_driver_msgs::FpaImubias, output_ns + "/fpa/imubias", 5);
-        driver_.AddFpaObserver(fpa::FpaImubiasPayload::MSG_NAME, [this](const fpa::FpaPayload& payload) {
-            auto imubias_payload = dynamic_cast<const fpa::FpaImubiasPayload&>(payload);
+        driver_.AddFpaObserver<fpa::FpaImubiasPayload>([this](const fpa::FpaImubiasPayload& imubias_payload) {
             PublishFpaImubias(imubias_payload, fpa_imubias_pub_);
-            fusion_epoch_data_.CollectFpaImubias(imubias_payload);
+            fusion_epoch_data_.Active().CollectFpaImubias(imubias_payload);
         });
     }
 
     // FP_A-RAWIMU
     if (params_.MessageEnabled(fpa::FpaRawimuPayload::MSG_NAME)) {
         _PUB(rawimu_pub_, sensor_msgs::Imu, output_ns + "/fpa/rawimu", 5);
-        driver_.AddFpaObserver(fpa::FpaRawimuPayload::MSG_NAME, [this](const fpa::FpaPayload& payload) {
-            PublishFpaRawimu(dynamic_cast<const fpa::FpaRawimuPayload&>(payload), rawimu_pub_);
+        driver_.AddFpaObserver<fpa::FpaRawimuPayload>([this](const fpa::FpaRawimuPayload& payload) {
+            PublishFpaRawimu(payload, rawimu_pub_);
         });
     }
 
     // FP_A-CORRIMU
     if (params_.MessageEnabled(fpa::FpaCorrimuPayload::MSG_NAME)) {
         _PUB(corrimu_pub_, sensor_msgs::Imu, output_ns + "/fpa/corrimu", 5);
-        driver_.AddFpaObserver(fpa::FpaCorrimuPayload::MSG_NAME, [this](const fpa::FpaPayload& payload) {
-            PublishFpaCorrimu(dynamic_cast<const fpa::FpaCorrimuPayload&>(payload), corrimu_pub_);
+        driver_.AddFpaObserver<fpa::FpaCorrimuPayload>([this](const fpa::FpaCorrimuPayload& payload) {
+            PublishFpaCorrimu(payload, corrimu_pub_);
         });
     }
 
     // FP_A-TEXT
     if (params_.MessageEnabled(fpa::FpaTextPayload::MSG_NAME)) {
         _PUB(fpa_text_pub_, fixposition_driver_msgs::FpaText, output_ns + "/fpa/text", 5);
-        driver_.AddFpaObserver(fpa::FpaTextPayload::MSG_NAME, [this](const fpa::FpaPayload& payload) {
-            PublishFpaText(dynamic_cast<const fpa::FpaTextPayload&>(payload), fpa_text_pub_);
+        driver_.AddFpaObserver<fpa::FpaTextPayload>([this](const fpa::FpaTextPayload& payload) {
+            PublishFpaText(payload, fpa_text_pub_);
         });
     }
 
     // FP_A-TP
     if (params_.MessageEnabled(fpa::FpaTpPayload::MSG_NAME)) {
         _PUB(fpa_tp_pub_, fixposition_driver_msgs::FpaTp, output_ns + "/fpa/tp", 5);
-        driver_.AddFpaObserver(fpa::FpaTpPayload::MSG_NAME, [this](const fpa::FpaPayload& payload) {
-            PublishFpaTp(dynamic_cast<const fpa::FpaTpPayload&>(payload), fpa_tp_pub_);
+        driver_.AddFpaObserver<fpa::FpaTpPayload>([this](const fpa::FpaTpPayload& payload) {
+            PublishFpaTp(payload, fpa_tp_pub_);
         });
     }
 
@@ -250,98 +248,89 @@ bool FixpositionDriverNode::StartNode() {
                 if (!PublishNovbInspvax(header, (novb::NovbInspvax*)payload, novb_inspvax_pub_)) {
                     ROS_WARN_THROTTLE(1.0, "Bad NOV_B-INSPVAX");
                 }
-                fusion_epoch_data_.CollectNovbInspvax(header, (novb::NovbInspvax*)payload);
+                fusion_epoch_data_.Active().CollectNovbInspvax(header, (novb::NovbInspvax*)payload);
             });
     }
 
     // NMEA-GP-GGA
     if (params_.MessageEnabled(nmea::NmeaGgaPayload::FORMATTER)) {
         _PUB(nmea_gga_pub_, fixposition_driver_msgs::NmeaGga, output_ns + "/nmea/gga", 5);
-        driver_.AddNmeaObserver(nmea::NmeaGgaPayload::FORMATTER, [this](const nmea::NmeaPayload& payload) {
-            auto gga_payload = dynamic_cast<const nmea::NmeaGgaPayload&>(payload);
+        driver_.SetNmeaConsumer<nmea::NmeaGgaPayload>([this](nmea::NmeaGgaPayload&& gga_payload) {
             PublishNmeaGga(gga_payload, nmea_gga_pub_);
-            nmea_epoch_data_.gga_ = gga_payload;
+            nmea_epoch_data_.Active().gga_ = std::move(gga_payload);
         });
     }
 
     // NMEA-GP-GLL
     if (params_.MessageEnabled(nmea::NmeaGllPayload::FORMATTER)) {
         _PUB(nmea_gll_pub_, fixposition_driver_msgs::NmeaGll, output_ns + "/nmea/gll", 5);
-        driver_.AddNmeaObserver(nmea::NmeaGllPayload::FORMATTER, [this](const nmea::NmeaPayload& payload) {
-            auto gll_payload = dynamic_cast<const nmea::NmeaGllPayload&>(payload);
+        driver_.SetNmeaConsumer<nmea::NmeaGllPayload>([this](nmea::NmeaGllPayload&& gll_payload) {
             PublishNmeaGll(gll_payload, nmea_gll_pub_);
-            nmea_epoch_data_.gll_ = gll_payload;
+            nmea_epoch_data_.Active().gll_ = std::move(gll_payload);
         });
     }
 
     // NMEA-GN-GSA
     if (params_.MessageEnabled(nmea::NmeaGsaPayload::FORMATTER)) {
         _PUB(nmea_gsa_pub_, fixposition_driver_msgs::NmeaGsa, output_ns + "/nmea/gsa", 5);
-        driver_.AddNmeaObserver(nmea::NmeaGsaPayload::FORMATTER, [this](const nmea::NmeaPayload& payload) {
-            auto gsa_payload_ = dynamic_cast<const nmea::NmeaGsaPayload&>(payload);
+        driver_.SetNmeaConsumer<nmea::NmeaGsaPayload>([this](nmea::NmeaGsaPayload&& gsa_payload_) {
             PublishNmeaGsa(gsa_payload_, nmea_gsa_pub_);
-            nmea_epoch_data_.gsa_ = gsa_payload_;
-            nmea_epoch_data_.gsa_gsv_.AddGsa(gsa_payload_);
+            nmea_epoch_data_.Active().gsa_gsv_.AddGsa(gsa_payload_);
+            nmea_epoch_data_.Active().gsa_ = std::move(gsa_payload_);
         });
     }
 
     // NMEA-GP-GST
     if (params_.MessageEnabled(nmea::NmeaGstPayload::FORMATTER)) {
         _PUB(nmea_gst_pub_, fixposition_driver_msgs::NmeaGst, output_ns + "/nmea/gst", 5);
-        driver_.AddNmeaObserver(nmea::NmeaGstPayload::FORMATTER, [this](const nmea::NmeaPayload& payload) {
-            auto gst_payload = dynamic_cast<const nmea::NmeaGstPayload&>(payload);
+        driver_.SetNmeaConsumer<nmea::NmeaGstPayload>([this](nmea::NmeaGstPayload&& gst_payload) {
             PublishNmeaGst(gst_payload, nmea_gst_pub_);
-            nmea_epoch_data_.gst_ = gst_payload;
+            nmea_epoch_data_.Active().gst_ = std::move(gst_payload);
         });
     }
 
     // NMEA-GX-GSV
     if (params_.MessageEnabled(nmea::NmeaGsvPayload::FORMATTER)) {
         _PUB(nmea_gsv_pub_, fixposition_driver_msgs::NmeaGsv, output_ns + "/nmea/gsv", 5);
-        driver_.AddNmeaObserver(nmea::NmeaGsvPayload::FORMATTER, [this](const nmea::NmeaPayload& payload) {
-            auto gsv_payload_ = dynamic_cast<const nmea::NmeaGsvPayload&>(payload);
+        driver_.SetNmeaConsumer<nmea::NmeaGsvPayload>([this](nmea::NmeaGsvPayload&& gsv_payload_) {
             PublishNmeaGsv(gsv_payload_, nmea_gsv_pub_);
-            nmea_epoch_data_.gsa_gsv_.AddGsv(gsv_payload_);
+            nmea_epoch_data_.Active().gsa_gsv_.AddGsv(gsv_payload_);
         });
     }
 
     // NMEA-GP-HDT
     if (params_.MessageEnabled(nmea::NmeaHdtPayload::FORMATTER)) {
         _PUB(nmea_hdt_pub_, fixposition_driver_msgs::NmeaHdt, output_ns + "/nmea/hdt", 5);
-        driver_.AddNmeaObserver(nmea::NmeaHdtPayload::FORMATTER, [this](const nmea::NmeaPayload& payload) {
-            auto hdt_payload = dynamic_cast<const nmea::NmeaHdtPayload&>(payload);
+        driver_.SetNmeaConsumer<nmea::NmeaHdtPayload>([this](nmea::NmeaHdtPayload&& hdt_payload) {
             PublishNmeaHdt(hdt_payload, nmea_hdt_pub_);
-            nmea_epoch_data_.hdt_ = hdt_payload;
+            nmea_epoch_data_.Active().hdt_ = std::move(hdt_payload);
         });
     }
 
     // NMEA-GP-RMC
     if (params_.MessageEnabled(nmea::NmeaRmcPayload::FORMATTER)) {
         _PUB(nmea_rmc_pub_, fixposition_driver_msgs::NmeaRmc, output_ns + "/nmea/rmc", 5);
-        driver_.AddNmeaObserver(nmea::NmeaRmcPayload::FORMATTER, [this](const nmea::NmeaPayload& payload) {
-            auto rmc_payload = dynamic_cast<const nmea::NmeaRmcPayload&>(payload);
+        driver_.SetNmeaConsumer<nmea::NmeaRmcPayload>([this](nmea::NmeaRmcPayload&& rmc_payload) {
             PublishNmeaRmc(rmc_payload, nmea_rmc_pub_);
-            nmea_epoch_data_.rmc_ = rmc_payload;
+            nmea_epoch_data_.Active().rmc_ = std::move(rmc_payload);
         });
     }
 
     // NMEA-GP-VTG
     if (params_.MessageEnabled(nmea::NmeaVtgPayload::FORMATTER)) {
         _PUB(nmea_vtg_pub_, fixposition_driver_msgs::NmeaVtg, output_ns + "/nmea/vtg", 5);
-        driver_.AddNmeaObserver(nmea::NmeaVtgPayload::FORMATTER, [this](const nmea::NmeaPayload& payload) {
-            auto vtg_payload = dynamic_cast<const nmea::NmeaVtgPayload&>(payload);
+        driver_.SetNmeaConsumer<nmea::NmeaVtgPayload>([this](nmea::NmeaVtgPayload&& vtg_payload) {
             PublishNmeaVtg(vtg_payload, nmea_vtg_pub_);
-            nmea_epoch_data_.vtg_ = vtg_payload;
+            nmea_epoch_data_.Active().vtg_ = std::move(vtg_payload);
         });
     }
 
     // NMEA-GP-ZDA
     if (params_.MessageEnabled(nmea::NmeaZdaPayload::FORMATTER)) {
         _PUB(nmea_zda_pub_, fixposition_driver_msgs::NmeaZda, output_ns + "/nmea/zda", 5);
-        driver_.AddNmeaObserver(nmea::NmeaZdaPayload::FORMATTER, [this](const nmea::NmeaPayload& payload) {
-            auto zda_payload = dynamic_cast<const nmea::NmeaZdaPayload&>(payload);
+        driver_.SetNmeaConsumer<nmea::NmeaZdaPayload>([this](nmea::NmeaZdaPayload&& zda_payload) {
             PublishNmeaZda(zda_payload, nmea_zda_pub_);
-            nmea_epoch_data_.zda_ = zda_payload;
+            nmea_epoch_data_.Active().zda_ = std::move(zda_payload);
         });
     }
 
@@ -368,6 +357,13 @@ bool FixpositionDriverNode::StartNode() {
         _PUB(jump_pub_, fixposition_driver_msgs::CovWarn, output_ns + "/extras/jump", 5);
     }
 
+    // Driver statistics, published at a low rate (counters, queue depths and receive-to-publish latency percentiles,
+    // see FixpositionDriver::GetStats())
+    _PUB(stats_pub_, fixposition_driver_msgs::DriverStats, output_ns + "/extras/stats", 5);
+    stats_timer_ = nh_.createTimer(ros::Duration(1.0), [this](const ros::TimerEvent&) {
+        PublishDriverStats(driver_.GetStats(), tf_throttle_.GetStats(), ros::Time::now(), stats_pub_);
+    });
+
     // Subscribe to correction data input
     if (!params_.corr_topic_.empty()) {
         _SUB(corr_sub_, rtcm_msgs::Message, params_.corr_topic_, 100, [this](const rtcm_msgs::MessageConstPtr& msg) {
@@ -379,7 +375,9 @@ bool FixpositionDriverNode::StartNode() {
     if (!params_.speed_topic_.empty()) {
         _SUB(ws_sub_, fixposition_driver_msgs::Speed, params_.speed_topic_, 10,
              [this](const fixposition_driver_msgs::SpeedConstPtr& msg) {
-                 driver_.SendWheelspeedData(SpeedMsgToWheelspeedData(*msg));
+                 std::unique_lock<std::mutex> lock(driver_mutex_);
+                 SpeedMsgToWheelspeedData(*msg, ws_data_);
+                 driver_.SendWheelspeedData(ws_data_);
              });
     }
 
@@ -390,19 +388,25 @@ bool FixpositionDriverNode::StartNode() {
                 case DriverParams::VelTopicType::TWIST:
                     _SUB(ws_conv_sub_, geometry_msgs::Twist, params_.converter_input_topic_, 10,
                          [this](const geometry_msgs::TwistConstPtr& msg) {
-                             driver_.SendWheelspeedData(Vector3MsgToWheelspeedData(msg->linear, params_));
+                             std::unique_lock<std::mutex> lock(driver_mutex_);
+                             Vector3MsgToWheelspeedData(msg->linear, params_, ws_data_);
+                             driver_.SendWheelspeedData(ws_data_);
                          });
                     break;
                 case DriverParams::VelTopicType::TWISTWITHCOV:
                     _SUB(ws_conv_sub_, geometry_msgs::TwistWithCovariance, params_.converter_input_topic_, 10,
                          [this](const geometry_msgs::TwistWithCovarianceConstPtr& msg) {
-                             driver_.SendWheelspeedData(Vector3MsgToWheelspeedData(msg->twist.linear, params_));
+                             std::unique_lock<std::mutex> lock(driver_mutex_);
+                             Vector3MsgToWheelspeedData(msg->twist.linear, params_, ws_data_);
+                             driver_.SendWheelspeedData(ws_data_);
                          });
                     break;
                 case DriverParams::VelTopicType::ODOMETRY:
                     _SUB(ws_conv_sub_, nav_msgs::Odometry, params_.converter_input_topic_, 10,
                          [this](const nav_msgs::OdometryConstPtr& msg) {
-                             driver_.SendWheelspeedData(Vector3MsgToWheelspeedData(msg->twist.twist.linear, params_));
+                             std::unique_lock<std::mutex> lock(driver_mutex_);
+                             Vector3MsgToWheelspeedData(msg->twist.twist.linear, params_, ws_data_);
+                             driver_.SendWheelspeedData(ws_data_);
                          });
                     break;
                 default:
@@ -472,6 +476,8 @@ void FixpositionDriverNode::StopNode() {
     // - Other
     jump_pub_.shutdown();
     raw_pub_.shutdown();
+    stats_timer_.stop();
+    stats_pub_.shutdown();
 
     // Stop input message subscribers
     ws_sub_.shutdown();
@@ -485,24 +491,33 @@ void FixpositionDriverNode::ProcessTfData(const TfData& tf_data) {
     geometry_msgs::TransformStamped tf;
     TfDataToTransformStamped(tf_data, tf);
 
+    // Change detection and rate decimation for the /tf output (see TfThrottle). Suppressed transforms are
+    // still processed below (IMU YPR output, Nav2 TF storage), only the broadcast is skipped.
+    const bool send_tf =
+        tf_throttle_.Accept(tf_data.frame_id, tf_data.child_frame_id, tf_data.translation, tf_data.rotation);
+
     // TODO: use constants from helper.hpp?
 
     if ((tf.child_frame_id == "FP_IMUH") && (tf.header.frame_id == "FP_POI")) {
-        tf_br_.sendTransform(tf);
+        if (send_tf) {
+            tf_br_.sendTransform(tf);
+        }
 
         // Publish pitch roll based on IMU only
         Eigen::Vector3d imu_ypr_eigen = trafo::QuatToEul(tf_data.rotation);
         imu_ypr_eigen.x() = 0.0;  // the yaw value is not observable using IMU alone
-        geometry_msgs::Vector3Stamped imu_ypr;
-        imu_ypr.header.stamp = tf.header.stamp;
-        imu_ypr.header.frame_id = "FP_POI";
-        tf::vectorEigenToMsg(imu_ypr_eigen, imu_ypr.vector);
+        auto imu_ypr = boost::make_shared<geometry_msgs::Vector3Stamped>();
+        imu_ypr->header.stamp = tf.header.stamp;
+        imu_ypr->header.frame_id = "FP_POI";
+        tf::vectorEigenToMsg(imu_ypr_eigen, imu_ypr->vector);
         eul_imu_pub_.publish(imu_ypr);
 
     }
     // FP_POI -> FP_POISH
     else if ((tf.child_frame_id == "FP_POISH") && (tf.header.frame_id == "FP_POI")) {
-        tf_br_.sendTransform(tf);
+        if (send_tf) {
+            tf_br_.sendTransform(tf);
+        }
         // Store TF if Nav2 mode is enabled
         if (params_.nav2_mode_) {
             std::unique_lock<std::mutex> lock(tfs_.mutex_);
@@ -511,16 +526,31 @@ void FixpositionDriverNode::ProcessTfData(const TfData& tf_data) {
     }
     // FP_ECEF -> FP_ENU0
     else if ((tf.child_frame_id == "FP_ENU0") && (tf.header.frame_id == "FP_ECEF")) {
-        static_br_.sendTransform(tf);
-        // Store TF if Nav2 mode is enabled
+        if (send_tf) {
+            static_br_.sendTransform(tf);
+        }
+        // Store TF if Nav2 mode is enabled, refreshing the cached ENU reference only when the transform actually
+        // changed (it is effectively static after startup), so that PublishNav2Tf() does not have to derive it on
+        // every fusion epoch
         if (params_.nav2_mode_) {
             std::unique_lock<std::mutex> lock(tfs_.mutex_);
+            if (!tfs_.ref_valid_ || !tfs_.t_ecef_enu0_.isApprox(tf_data.translation) ||
+                !tfs_.q_ecef_enu0_.isApprox(tf_data.rotation)) {
+                tfs_.t_ecef_enu0_ = tf_data.translation;
+                tfs_.q_ecef_enu0_ = tf_data.rotation;
+                tfs_.llh_enu0_ = trafo::TfWgs84LlhEcef(tf_data.translation);
+                tfs_.q_enu0_ecef_ = tf_data.rotation.inverse();
+                tfs_.ref_valid_ = true;
+                tfs_.map_dirty_ = true;
+            }
             tfs_.ecef_enu0_ = std::make_unique<geometry_msgs::TransformStamped>(tf);
         }
     }
     // Something else
     else {
-        static_br_.sendTransform(tf);
+        if (send_tf) {
+            static_br_.sendTransform(tf);
+        }
     }
 }
 
@@ -541,7 +571,9 @@ void FixpositionDriverNode::ProcessOdometryData(const OdometryData& odometry_dat
     switch (odometry_data.type) {
         case OdometryData::Type::ODOMETRY:
 
-            if (odometry_data.valid) {
+            if (odometry_data.valid &&
+                tf_throttle_.Accept(odometry_data.frame_id, odometry_data.child_frame_id,
+                                    odometry_data.pose.position, odometry_data.pose.orientation)) {
                 geometry_msgs::TransformStamped tf;
                 OdometryDataToTransformStamped(odometry_data, tf);
                 tf_br_.sendTransform(tf);
@@ -549,7 +581,7 @@ void FixpositionDriverNode::ProcessOdometryData(const OdometryData& odometry_dat
 
             // Output jump warning
             if (params_.cov_warning_ && odometry_data.valid && jump_detector_.Check(odometry_data)) {
-                ROS_WARN(jump_detector_.warning_.c_str());
+                ROS_WARN("%s", jump_detector_.warning_);
                 PublishJumpWarning(jump_detector_, jump_pub_);
             }
 
@@ -581,34 +613,43 @@ void FixpositionDriverNode::ProcessOdometryData(const OdometryData& odometry_dat
 // ---------------------------------------------------------------------------------------------------------------------
 
 void FixpositionDriverNode::PublishNav2Tf() {
-    std::unique_lock<std::mutex> lock(tfs_.mutex_);
-    // We'll need all before we can start publishing the Nav2 TFs
-    if (!tfs_.ecef_enu0_ || !tfs_.poi_poish_ || !tfs_.ecef_poish_ || !tfs_.enu0_poi_) {
-        return;
-    }
-
-    // Publish FP_ECEF -> map
-    tfs_.ecef_enu0_->child_frame_id = "map";
-    static_br_.sendTransform(*tfs_.ecef_enu0_);
-
-    // Compute FP_ENU0 -> FP_POISH
-    // Extract translation and rotation from ECEFENU0
-    geometry_msgs::Vector3 trans_ecef_enu0 = tfs_.ecef_enu0_->transform.translation;
-    geometry_msgs::Quaternion rot_ecef_enu0 = tfs_.ecef_enu0_->transform.rotation;
-    Eigen::Vector3d t_ecef_enu0_;
-    t_ecef_enu0_ << trans_ecef_enu0.x, trans_ecef_enu0.y, trans_ecef_enu0.z;
-    Eigen::Quaterniond q_ecef_enu0_(rot_ecef_enu0.w, rot_ecef_enu0.x, rot_ecef_enu0.y, rot_ecef_enu0.z);
-
-    // Extract translation and rotation from ECEFPOISH
-    geometry_msgs::Vector3 trans_ecef_poish = tfs_.ecef_poish_->transform.translation;
-    geometry_msgs::Quaternion rot_ecef_poish = tfs_.ecef_poish_->transform.rotation;
-    Eigen::Vector3d t_ecef_poish;
-    t_ecef_poish << trans_ecef_poish.x, trans_ecef_poish.y, trans_ecef_poish.z;
-    Eigen::Quaterniond q_ecef_poish(rot_ecef_poish.w, rot_ecef_poish.x, rot_ecef_poish.y, rot_ecef_poish.z);
+    // Snapshot the collected transforms and the cached ENU reference. The mutex is held only for these copies, the
+    // math and the publishing below do not block the collecting observers.
+    geometry_msgs::TransformStamped ecef_enu0;
+    geometry_msgs::TransformStamped ecef_poish;
+    geometry_msgs::TransformStamped enu0_poi;
+    Eigen::Vector3d llh_enu0;
+    Eigen::Quaterniond q_enu0_ecef;
+    bool map_dirty = false;
+    {
+        std::unique_lock<std::mutex> lock(tfs_.mutex_);
+        // We'll need all before we can start publishing the Nav2 TFs
+        if (!tfs_.ecef_enu0_ || !tfs_.poi_poish_ || !tfs_.ecef_poish_ || !tfs_.enu0_poi_) {
+            return;
+        }
+        ecef_enu0 = *tfs_.ecef_enu0_;
+        ecef_poish = *tfs_.ecef_poish_;
+        enu0_poi = *tfs_.enu0_poi_;
+        llh_enu0 = tfs_.llh_enu0_;
+        q_enu0_ecef = tfs_.q_enu0_ecef_;
+        map_dirty = tfs_.map_dirty_;
+        tfs_.map_dirty_ = false;
+    }
 
-    // Compute the ENU transformation
-    const Eigen::Vector3d t_enu0_poish = trafo::TfEnuEcef(t_ecef_poish, trafo::TfWgs84LlhEcef(t_ecef_enu0_));
-    const Eigen::Quaterniond q_enu0_poish = q_ecef_enu0_.inverse() * q_ecef_poish;
+    // Publish FP_ECEF -> map, but only when it changed (the static broadcaster latches it)
+    if (map_dirty) {
+        ecef_enu0.child_frame_id = "map";
+        static_br_.sendTransform(ecef_enu0);
+    }
+
+    // Compute FP_ENU0 -> FP_POISH from the dynamic FP_ECEF -> FP_POISH transform and the cached ENU reference
+    Eigen::Vector3d t_ecef_poish;
+    t_ecef_poish << ecef_poish.transform.translation.x, ecef_poish.transform.translation.y,
+        ecef_poish.transform.translation.z;
+    const Eigen::Quaterniond q_ecef_poish(ecef_poish.transform.rotation.w, ecef_poish.transform.rotation.x,
+                                          ecef_poish.transform.rotation.y, ecef_poish.transform.rotation.z);
+    const Eigen::Vector3d t_enu0_poish = trafo::TfEnuEcef(t_ecef_poish, llh_enu0);
+    const Eigen::Quaterniond q_enu0_poish = q_enu0_ecef * q_ecef_poish;
 
     // Create tf2::Transform tf_ENU0POISH
     tf2::Transform tf_ENU0POISH;
@@ -619,7 +660,7 @@ void FixpositionDriverNode::PublishNav2Tf() {
     // Publish map -> odom
     // Multiply the transforms
     tf2::Transform tf_ENU0POI;
-    tf2::fromMsg(tfs_.enu0_poi_->transform, tf_ENU0POI);
+    tf2::fromMsg(enu0_poi.transform, tf_ENU0POI);
     tf2::Transform tf_combined = tf_ENU0POI * tf_ENU0POISH.inverse();
 
     // Create a new TransformStamped message
@@ -643,77 +684,3 @@ void FixpositionDriverNode::PublishNav2Tf() {
 
 /* ****************************************************************************************************************** */
 }  // namespace fixposition
-
-using namespace fixposition;
-
-int main(int argc, char** argv) {
-#ifndef NDEBUG
-    fpsdk::common::app::StacktraceHelper stacktrace;
-    WARNING("***** Running debug build *****");
-#endif
-
-    bool ok = true;
-
-    // Initialise ROS, create node handle
-    ros::init(argc, argv, "fixposition_driver");
-    ros::NodeHandle node_handle("~");
-
-    // Redirect Fixposition SDK logging to ROS console
-    fpsdk::ros1::utils::RedirectLoggingToRosConsole();
-
-    // Say hello
-    HelloWorld();
-
-    // Load parameters
-    ROS_INFO("Loading parameters...");
-    DriverParams driver_params;
-    if (!LoadParamsFromRos1("~", driver_params)) {
-        ROS_ERROR("Failed loading sensor params");
-        ok = false;
-    }
-
-    // Handle CTRL-C / SIGINT ourselves
-    fpsdk::common::app::SigIntHelper sigint;
-
-    // Start node
-    std::unique_ptr<FixpositionDriverNode> node;
-    if (ok) {
-        try {
-            node = std::make_unique<FixpositionDriverNode>(driver_params, node_handle);
-        } catch (const std::exception& ex) {
-            ROS_ERROR("Failed creating node: %s", ex.what());
-            ok = false;
-        }
-    }
-    if (ok) {
-        ROS_INFO("Starting node...");
-        if (node->StartNode()) {
-            ROS_INFO("main() spinning...");
-            // Use multiple spinner threads. Callback execute in one of them.
-            ros::AsyncSpinner spinner(4);
-            spinner.start();
-            sigint.WaitAbort();
-            spinner.stop();
-            ROS_INFO("main() stopping");
-        } else {
-            ROS_ERROR("Failed starting node");
-            ok = false;
-        }
-        node->StopNode();
-        node.reset();
-    }
-
-    // Are we happy?
-    if (ok) {
-        ROS_INFO("Done");
-    } else {
-        ROS_FATAL("Ouch!");
-    }
-
-    // Shutdown ROS
-    ros::shutdown();
-
-    exit(ok ? EXIT_SUCCESS : EXIT_FAILURE);
-}
-
-/* ****************************************************************************************************************** */
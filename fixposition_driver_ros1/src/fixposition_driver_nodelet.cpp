@@ -0,0 +1,79 @@
+/**
+ * \verbatim
+ * ___    ___
+ * \  \  /  /
+ *  \  \/  /   Copyright (c) Fixposition AG (www.fixposition.com) and contributors
+ *  /  /\  \   License: see the LICENSE file
+ * /__/  \__\
+ * \endverbatim
+ *
+ * @file
+ * @brief Fixposition driver nodelet for ROS1
+ *
+ * Hosts the FixpositionDriverNode in a nodelet manager, so that subscribers running in the same manager get the
+ * messages by shared pointer instead of through TCPROS serialisation (zero-copy intra-process transport).
+ */
+
+/* LIBC/STL */
+#include <memory>
+
+/* EXTERNAL */
+#include <fpsdk_ros1/utils.hpp>
+#include <nodelet/nodelet.h>
+#include <pluginlib/class_list_macros.h>
+
+/* PACKAGE */
+#include "fixposition_driver_ros1/fixposition_driver_node.hpp"
+
+namespace fixposition {
+/* ****************************************************************************************************************** */
+
+class FixpositionDriverNodelet : public nodelet::Nodelet {
+   public:
+    FixpositionDriverNodelet() {}
+
+    ~FixpositionDriverNodelet() {
+        if (node_) {
+            node_->StopNode();
+            node_.reset();
+        }
+    }
+
+   private:
+    void onInit() final {
+        // Redirect Fixposition SDK logging to ROS console
+        fpsdk::ros1::utils::RedirectLoggingToRosConsole();
+
+        // Say hello
+        HelloWorld();
+
+        // Load parameters from the nodelet's private namespace
+        ros::NodeHandle nh = getPrivateNodeHandle();
+        NODELET_INFO("Loading parameters...");
+        DriverParams driver_params;
+        if (!LoadParamsFromRos1(nh.getNamespace(), driver_params)) {
+            NODELET_ERROR("Failed loading sensor params");
+            return;
+        }
+
+        // Start node. The nodelet manager provides the spinner threads.
+        try {
+            node_ = std::make_unique<FixpositionDriverNode>(driver_params, nh);
+        } catch (const std::exception& ex) {
+            NODELET_ERROR("Failed creating node: %s", ex.what());
+            return;
+        }
+        NODELET_INFO("Starting node...");
+        if (!node_->StartNode()) {
+            NODELET_ERROR("Failed starting node");
+            node_.reset();
+        }
+    }
+
+    std::unique_ptr<FixpositionDriverNode> node_;  //!< The hosted driver node
+};
+
+/* ****************************************************************************************************************** */
+}  // namespace fixposition
+
+PLUGINLIB_EXPORT_CLASS(fixposition::FixpositionDriverNodelet, nodelet::Nodelet);
@@ -35,10 +35,12 @@ bool LoadParamsFromRos1(const std::string& ns, DriverParams& params) {
         ROS_WARN("Failed loading %s/stream param", ns.c_str());
         ok = false;
     }
+    utils::LoadRosParam(ns + "/extra_streams", params.extra_streams_);  // optional
     if (!utils::LoadRosParam(ns + "/reconnect_delay", params.reconnect_delay_)) {
         ROS_WARN("Failed loading %s/reconnect_delay param", ns.c_str());
         ok = false;
     }
+    utils::LoadRosParam(ns + "/reconnect_delay_max", params.reconnect_delay_max_);  // optional
     if (!utils::LoadRosParam(ns + "/delay_warning", params.delay_warning_)) {
         ROS_WARN("Failed loading %s/delay_warning param", ns.c_str());
         ok = false;
@@ -47,6 +49,7 @@ bool LoadParamsFromRos1(const std::string& ns, DriverParams& params) {
         ROS_WARN("Failed loading %s/messages param", ns.c_str());
         ok = false;
     }
+    utils::LoadRosParam(ns + "/decimation", params.decimation_);  // optional
     if (!utils::LoadRosParam(ns + "/fusion_epoch", params.fusion_epoch_)) {
         ROS_WARN("Failed loading %s/fusion_epoch param", ns.c_str());
         ok = false;
@@ -64,6 +67,9 @@ bool LoadParamsFromRos1(const std::string& ns, DriverParams& params) {
         ROS_WARN("Failed loading %s/raw_output param", ns.c_str());
         ok = false;
     }
+    utils::LoadRosParam(ns + "/raw_record_path", params.raw_record_path_);        // optional
+    utils::LoadRosParam(ns + "/raw_record_size_mb", params.raw_record_size_mb_);  // optional
+    utils::LoadRosParam(ns + "/shm_output", params.shm_output_);                  // optional
     if (!utils::LoadRosParam(ns + "/cov_warning", params.cov_warning_)) {
         ROS_WARN("Failed loading %s/cov_warning param", ns.c_str());
         ok = false;
@@ -72,6 +78,12 @@ bool LoadParamsFromRos1(const std::string& ns, DriverParams& params) {
         ROS_WARN("Failed loading %s/nav2_mode param", ns.c_str());
         ok = false;
     }
+    utils::LoadRosParam(ns + "/tf_epsilon_trans", params.tf_epsilon_trans_);  // optional
+    utils::LoadRosParam(ns + "/tf_epsilon_rot", params.tf_epsilon_rot_);      // optional
+    utils::LoadRosParam(ns + "/tf_max_rate", params.tf_max_rate_);            // optional
+    utils::LoadRosParam(ns + "/thread_sched", params.thread_sched_);  // optional
+    utils::LoadRosParam(ns + "/thread_prio", params.thread_prio_);    // optional
+    utils::LoadRosParam(ns + "/thread_cpus", params.thread_cpus_);    // optional
     if (!utils::LoadRosParam(ns + "/converter/enabled", params.converter_enabled_)) {
         ROS_WARN("Failed loading %s/converter/enabled param", ns.c_str());
         ok = false;
@@ -126,16 +138,31 @@ bool LoadParamsFromRos1(const std::string& ns, DriverParams& params) {
     }
 
     ROS_INFO("DriverParams: stream=%s", params.stream_.c_str());
-    ROS_INFO("DriverParams: reconnect_delay=%.1f", params.reconnect_delay_);
+    for (std::size_t ix = 0; ix < params.extra_streams_.size(); ix++) {
+        ROS_INFO("DriverParams: extra_streams[%" PRIuMAX "]=%s", ix, params.extra_streams_[ix].c_str());
+    }
+    ROS_INFO("DriverParams: reconnect_delay=%.1f reconnect_delay_max=%.1f", params.reconnect_delay_,
+             params.reconnect_delay_max_);
     ROS_INFO("DriverParams: delay_warning=%.3f", params.delay_warning_);
     for (std::size_t ix = 0; ix < params.messages_.size(); ix++) {
         ROS_INFO("DriverParams: messages[%" PRIuMAX "]=%s", ix, params.messages_[ix].c_str());
     }
+    for (std::size_t ix = 0; ix < params.decimation_.size(); ix++) {
+        ROS_INFO("DriverParams: decimation[%" PRIuMAX "]=%s", ix, params.decimation_[ix].c_str());
+    }
     ROS_INFO("DriverParams: nmea_epoch=%s", epoch_str.c_str());
     ROS_INFO("DriverParams: fusion_epoch=%s", params.fusion_epoch_ ? "true" : "false");
     ROS_INFO("DriverParams: raw_output=%s", params.raw_output_ ? "true" : "false");
+    ROS_INFO("DriverParams: raw_record_path=%s", params.raw_record_path_.c_str());
+    ROS_INFO("DriverParams: raw_record_size_mb=%d", params.raw_record_size_mb_);
+    ROS_INFO("DriverParams: shm_output=%s", params.shm_output_.c_str());
     ROS_INFO("DriverParams: cov_warning=%s", params.cov_warning_ ? "true" : "false");
     ROS_INFO("DriverParams: nav2_mode=%s", params.nav2_mode_ ? "true" : "false");
+    ROS_INFO("DriverParams: tf_epsilon_trans=%g tf_epsilon_rot=%g tf_max_rate=%g", params.tf_epsilon_trans_,
+             params.tf_epsilon_rot_, params.tf_max_rate_);
+    ROS_INFO("DriverParams: thread_sched=%s", params.thread_sched_.c_str());
+    ROS_INFO("DriverParams: thread_prio=%d", params.thread_prio_);
+    ROS_INFO("DriverParams: thread_cpus=%s", params.thread_cpus_.c_str());
     ROS_INFO("DriverParams: converter_enabled=%s", params.converter_enabled_ ? "true" : "false");
     ROS_INFO("DriverParams: converter_topic_type=%s", topic_type_string_.c_str());
     ROS_INFO("DriverParams: converter_input_topic=%s", params.converter_input_topic_.c_str());
@@ -21,6 +21,7 @@
 /* EXTERNAL */
 #include <fixposition_driver_lib/fixposition_driver.hpp>
 #include <fixposition_driver_lib/helper.hpp>
+#include <fixposition_driver_lib/tf_throttle.hpp>
 #include <fpsdk_common/parser/fpa.hpp>
 #include <fpsdk_common/parser/novb.hpp>
 #include <fpsdk_ros2/ext/rclcpp.hpp>
@@ -101,6 +102,8 @@ void PublishNmeaEpochData(const NmeaEpochData& data, rclcpp::Publisher<fpmsgs::N
 void PublishOdometryData(const OdometryData& data, rclcpp::Publisher<nav_msgs::msg::Odometry>::SharedPtr& pub);
 void PublishJumpWarning(const JumpDetector& jump_detector, rclcpp::Publisher<fpmsgs::CovWarn>::SharedPtr& pub);
 void PublishFusionEpochData(const FusionEpochData& data, rclcpp::Publisher<fpmsgs::FusionEpoch>::SharedPtr& pub);
+void PublishDriverStats(const FixpositionDriver::Stats& stats, const TfThrottle::Stats& tf_stats,
+                        const rclcpp::Time& stamp, rclcpp::Publisher<fpmsgs::DriverStats>::SharedPtr& pub);
 
 /* ****************************************************************************************************************** */
 }  // namespace fixposition
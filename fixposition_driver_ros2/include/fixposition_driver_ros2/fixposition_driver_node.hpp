@@ -15,11 +15,17 @@
 #define __FIXPOSITION_DRIVER_ROS2_FIXPOSITION_DRIVER_NODE_HPP__
 
 /* LIBC/STL */
+#include <atomic>
+#include <chrono>
+#include <functional>
 #include <memory>
 #include <mutex>
+#include <thread>
+#include <vector>
 
 /* EXTERNAL */
 #include <fixposition_driver_lib/helper.hpp>
+#include <fixposition_driver_lib/tf_throttle.hpp>
 #include <fpsdk_ros2/ext/rclcpp.hpp>
 
 /* PACKAGE */
@@ -66,6 +72,19 @@ class FixpositionDriverNode {
     FixpositionDriver driver_;          //!< Sensor driver
     rclcpp::QoS qos_settings_;          //!< QoS settings
 
+    // Deferred ROS interface setup. StartNode() only registers the observers and queues one advertise job per
+    // publisher, starts the driver right away, and SetupRos() then creates the publishers, subscriptions and TF
+    // broadcasters in a background thread while sensor data is already being read. Each create_publisher() triggers
+    // DDS discovery work, which on embedded targets otherwise delays the first odometry output by seconds. Observers
+    // drop messages until the interface is complete (see RosReady()).
+    std::vector<std::function<void()>> advertise_jobs_;  //!< Queued publisher creations, run by SetupRos()
+    std::thread setup_thread_;                           //!< Background thread running SetupRos()
+    std::atomic<bool> ros_ready_ = false;                //!< Set by SetupRos() once the ROS interface is complete
+    std::atomic<bool> first_msg_logged_ = false;         //!< Time-to-first-publish has been reported
+    std::chrono::steady_clock::time_point start_time_;   //!< StartNode() time, for the startup timing reports
+    void SetupRos();                                     //!< Create the ROS interface (runs in setup_thread_)
+    bool RosReady();                                     //!< Whether observers may publish, reports first publish
+
     // ROS publishers
     // - FP_A messages
     rclcpp::Publisher<fpmsgs::FpaEoe>::SharedPtr fpa_eoe_pub_;                //!< FP_A-EOE message
@@ -112,8 +131,12 @@ class FixpositionDriverNode {
     rclcpp::Publisher<sensor_msgs::msg::NavSatFix>::SharedPtr navsatfix_gnss1_pub_;  //!< GNSS1 position and status
     rclcpp::Publisher<sensor_msgs::msg::NavSatFix>::SharedPtr navsatfix_gnss2_pub_;  //!< GNSS2 position and status
     // - Other
-    rclcpp::Publisher<fpmsgs::CovWarn>::SharedPtr jump_pub_;   //!< Jump warning topic
-    rclcpp::Publisher<fpmsgs::ParserMsg>::SharedPtr raw_pub_;  //!< Raw messages topic
+    rclcpp::Publisher<fpmsgs::CovWarn>::SharedPtr jump_pub_;       //!< Jump warning topic
+    rclcpp::Publisher<fpmsgs::ParserMsg>::SharedPtr raw_pub_;      //!< Raw messages topic
+    rclcpp::Publisher<fpmsgs::DriverStats>::SharedPtr stats_pub_;  //!< Driver statistics topic (low rate)
+    rclcpp::TimerBase::SharedPtr stats_timer_;                     //!< Timer for publishing the driver statistics
+    //! Handle for the dynamic parameter callback (runtime message set updates, see SetupRos())
+    rclcpp::node_interfaces::OnSetParametersCallbackHandle::SharedPtr params_cb_handle_;
 
     // ROS subscribers
     rclcpp::Subscription<fpmsgs::Speed>::SharedPtr ws_sub_;              //!< Wheelspeed input subscriber
@@ -125,14 +148,24 @@ class FixpositionDriverNode {
     rclcpp::Subscription<nav_msgs::msg::Odometry>::SharedPtr
         ws_conv_odom_sub_;  //!< Wheelspeed input converter subscriber (Odometry)
 
+    // Callback groups, so that with a multi-threaded executor the independent input paths (correction data resp.
+    // wheelspeed) can execute concurrently instead of serialising through a single spin thread. Each group is
+    // mutually exclusive, i.e. callbacks within one group still run one at a time and in order.
+    rclcpp::CallbackGroup::SharedPtr corr_cbgroup_;   //!< Callback group for correction data input
+    rclcpp::CallbackGroup::SharedPtr speed_cbgroup_;  //!< Callback group for wheelspeed input
+
     // TF broadcasters
     std::unique_ptr<tf2_ros::TransformBroadcaster> tf_br_;
     std::unique_ptr<tf2_ros::StaticTransformBroadcaster> static_br_;
 
     // State
     JumpDetector jump_detector_;
-    NmeaEpochData nmea_epoch_data_;      //!< NMEA epoch data collector
-    FusionEpochData fusion_epoch_data_;  //!< Fusion epoch data collector
+    TfThrottle tf_throttle_;                  //!< TF output gating (see DriverParams::tf_* params)
+    std::mutex driver_mutex_;                 //!< Serialises writes to the sensor (driver_.Send...())
+    std::vector<WheelSpeedData> ws_data_;     //!< Scratch for wheelspeed callbacks, protected by driver_mutex_
+    std::mutex epoch_mutex_;                  //!< Protects the epoch data collectors below
+    NmeaEpochCollector nmea_epoch_data_;      //!< NMEA epoch data collector
+    FusionEpochCollector fusion_epoch_data_;  //!< Fusion epoch data collector
 
     // TFs
     struct Tfs {
@@ -141,6 +174,15 @@ class FixpositionDriverNode {
         std::unique_ptr<geometry_msgs::msg::TransformStamped> poi_poish_;
         std::unique_ptr<geometry_msgs::msg::TransformStamped> ecef_poish_;
         std::unique_ptr<geometry_msgs::msg::TransformStamped> enu0_poi_;
+        // Cached ENU reference derived from ecef_enu0_ (see ProcessTfData()). The FP_ECEF -> FP_ENU0 transform is
+        // effectively static after startup, so the geodetic reference and the inverted rotation are refreshed only
+        // when it actually changes instead of being recomputed on every fusion epoch (see PublishNav2Tf()).
+        Eigen::Vector3d t_ecef_enu0_;     //!< ECEF position the cache was derived from
+        Eigen::Quaterniond q_ecef_enu0_;  //!< ECEF -> ENU0 rotation the cache was derived from
+        Eigen::Vector3d llh_enu0_;        //!< Geodetic (WGS84 LLH) position of the ENU reference
+        Eigen::Quaterniond q_enu0_ecef_;  //!< Inverted ECEF -> ENU0 rotation
+        bool ref_valid_ = false;          //!< Cache is populated
+        bool map_dirty_ = true;           //!< The (static) FP_ECEF -> map transform needs (re)publishing
     };
     Tfs tfs_;
 
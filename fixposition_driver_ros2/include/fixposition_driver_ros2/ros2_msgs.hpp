@@ -32,6 +32,8 @@
 #include <fixposition_driver_msgs/msg/speed.hpp>
 // - Extras
 #include <fixposition_driver_msgs/msg/cov_warn.hpp>
+#include <fixposition_driver_msgs/msg/driver_latency.hpp>
+#include <fixposition_driver_msgs/msg/driver_stats.hpp>
 // - FP-A
 #include <fixposition_driver_msgs/msg/fpa_consts.hpp>
 #include <fixposition_driver_msgs/msg/fpa_eoe.hpp>
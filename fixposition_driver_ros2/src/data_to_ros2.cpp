@@ -64,6 +64,24 @@ void OdometryDataToTransformStamped(const OdometryData& data, geometry_msgs::msg
 
 // ---------------------------------------------------------------------------------------------------------------------
 
+// Publish using a middleware-loaned message when the middleware supports zero-copy (shared memory) transport for the
+// message type, so that same-host subscribers get the data without serialisation or copy. Falls back to the usual
+// construct-and-copy path otherwise. Used for the high-rate topics (200 Hz IMU, odometry).
+template <typename MsgT, typename FillFnT>
+static void PublishMaybeLoaned(rclcpp::Publisher<MsgT>& pub, FillFnT fill) {
+    if (pub.can_loan_messages()) {
+        auto loaned = pub.borrow_loaned_message();
+        fill(loaned.get());
+        pub.publish(std::move(loaned));
+    } else {
+        MsgT msg;
+        fill(msg);
+        pub.publish(msg);
+    }
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
 template <typename SomeFpaOdoPayload, typename SomeOdoMsg>
 static void FpaOdomToRos(const SomeFpaOdoPayload& payload, SomeOdoMsg& msg) {
     msg.header.stamp = ros2::utils::ConvTime(FpaGpsTimeToTime(payload.gps_time));
@@ -138,12 +156,13 @@ void PublishFpaOdomsh(const fpa::FpaOdomshPayload& payload, rclcpp::Publisher<fp
 void PublishFpaOdometryDataImu(const fpa::FpaOdometryPayload& payload,
                                rclcpp::Publisher<sensor_msgs::msg::Imu>::SharedPtr& pub) {
     if (pub->get_subscription_count() > 0) {
-        sensor_msgs::msg::Imu msg;
-        msg.header.stamp = ros2::utils::ConvTime(FpaGpsTimeToTime(payload.gps_time));
-        msg.header.frame_id = ODOMETRY_FRAME_ID;
-        FpaFloat3ToVector3(payload.acc, msg.linear_acceleration);
-        FpaFloat3ToVector3(payload.rot, msg.angular_velocity);
-        pub->publish(msg);
+        PublishMaybeLoaned(*pub, [&payload](sensor_msgs::msg::Imu& msg) {
+            msg = sensor_msgs::msg::Imu();
+            msg.header.stamp = ros2::utils::ConvTime(FpaGpsTimeToTime(payload.gps_time));
+            msg.header.frame_id = ODOMETRY_FRAME_ID;
+            FpaFloat3ToVector3(payload.acc, msg.linear_acceleration);
+            FpaFloat3ToVector3(payload.rot, msg.angular_velocity);
+        });
     }
 }
 
@@ -152,43 +171,42 @@ void PublishFpaOdometryDataImu(const fpa::FpaOdometryPayload& payload,
 void PublishFpaOdometryDataNavSatFix(const fpa::FpaOdometryPayload& payload,
                                      rclcpp::Publisher<sensor_msgs::msg::NavSatFix>::SharedPtr& pub) {
     if (pub->get_subscription_count() > 0) {
-        sensor_msgs::msg::NavSatFix msg;
-        msg.header.stamp = ros2::utils::ConvTime(FpaGpsTimeToTime(payload.gps_time));
-        msg.header.frame_id = ODOMETRY_CHILD_FRAME_ID;
-
-        // Populate LLH position
-        PoseWithCovData pose;
-        pose.SetFromFpaOdomPayload(payload);
-        Eigen::Map<Eigen::Matrix<double, 3, 3>> cov_map =
-            Eigen::Map<Eigen::Matrix<double, 3, 3>>(msg.position_covariance.data());
-
-        if (pose.position.isZero()) {
-            msg.position_covariance_type = msg.COVARIANCE_TYPE_UNKNOWN;
-            cov_map = Eigen::Matrix3d::Zero();  // FIXME: necessary?
-        } else {
-            const Eigen::Vector3d llh_pos = trafo::TfWgs84LlhEcef(pose.position);
-            msg.latitude = math::RadToDeg(llh_pos(0));
-            msg.longitude = math::RadToDeg(llh_pos(1));
-            msg.altitude = llh_pos(2);
-
-            // Populate LLH covariance
-            const Eigen::Matrix3d p_cov_e = pose.cov.topLeftCorner(3, 3);
-            const Eigen::Matrix3d C_l_e = trafo::RotEnuEcef(pose.position);
-            const Eigen::Matrix3d p_cov_l = C_l_e * p_cov_e * C_l_e.transpose();
-            cov_map = p_cov_l;
-            msg.position_covariance_type = msg.COVARIANCE_TYPE_KNOWN;
-        }
-
-        // Populate LLH status
-        const fpa::FpaGnssFix fix = (payload.gnss1_fix > payload.gnss2_fix ? payload.gnss1_fix : payload.gnss2_fix);
-        msg.status.status = FpaGnssFixToNavSatStatusStatus(msg.status, fix);
-        if (msg.status.status != msg.status.STATUS_NO_FIX) {
-            msg.status.service = (msg.status.SERVICE_GPS | msg.status.SERVICE_GLONASS | msg.status.SERVICE_COMPASS |
-                                  msg.status.SERVICE_GALILEO);
-        }
+        PublishMaybeLoaned(*pub, [&payload](sensor_msgs::msg::NavSatFix& msg) {
+            msg = sensor_msgs::msg::NavSatFix();
+            msg.header.stamp = ros2::utils::ConvTime(FpaGpsTimeToTime(payload.gps_time));
+            msg.header.frame_id = ODOMETRY_CHILD_FRAME_ID;
+
+            // Populate LLH position
+            PoseWithCovData pose;
+            pose.SetFromFpaOdomPayload(payload);
+            Eigen::Map<Eigen::Matrix<double, 3, 3>> cov_map =
+                Eigen::Map<Eigen::Matrix<double, 3, 3>>(msg.position_covariance.data());
+
+            if (pose.position.isZero()) {
+                msg.position_covariance_type = msg.COVARIANCE_TYPE_UNKNOWN;
+                cov_map = Eigen::Matrix3d::Zero();  // FIXME: necessary?
+            } else {
+                const Eigen::Vector3d llh_pos = trafo::TfWgs84LlhEcef(pose.position);
+                msg.latitude = math::RadToDeg(llh_pos(0));
+                msg.longitude = math::RadToDeg(llh_pos(1));
+                msg.altitude = llh_pos(2);
+
+                // Populate LLH covariance
+                const Eigen::Matrix3d p_cov_e = pose.cov.topLeftCorner(3, 3);
+                const Eigen::Matrix3d C_l_e = trafo::RotEnuEcef(pose.position);
+                const Eigen::Matrix3d p_cov_l = C_l_e * p_cov_e * C_l_e.transpose();
+                cov_map = p_cov_l;
+                msg.position_covariance_type = msg.COVARIANCE_TYPE_KNOWN;
+            }
 
-        // Publish message
-        pub->publish(msg);
+            // Populate LLH status
+            const fpa::FpaGnssFix fix = (payload.gnss1_fix > payload.gnss2_fix ? payload.gnss1_fix : payload.gnss2_fix);
+            msg.status.status = FpaGnssFixToNavSatStatusStatus(msg.status, fix);
+            if (msg.status.status != msg.status.STATUS_NO_FIX) {
+                msg.status.service = (msg.status.SERVICE_GPS | msg.status.SERVICE_GLONASS | msg.status.SERVICE_COMPASS |
+                                      msg.status.SERVICE_GALILEO);
+            }
+        });
     }
 }
 
@@ -392,18 +410,20 @@ static void FpaImuPayloadToRos(const SomeFpaImuPayload& payload, sensor_msgs::ms
 
 void PublishFpaRawimu(const fpa::FpaRawimuPayload& payload, rclcpp::Publisher<sensor_msgs::msg::Imu>::SharedPtr& pub) {
     if (pub->get_subscription_count() > 0) {
-        sensor_msgs::msg::Imu msg;
-        FpaImuPayloadToRos(payload, msg);
-        pub->publish(msg);
+        PublishMaybeLoaned(*pub, [&payload](sensor_msgs::msg::Imu& msg) {
+            msg = sensor_msgs::msg::Imu();
+            FpaImuPayloadToRos(payload, msg);
+        });
     }
 }
 
 void PublishFpaCorrimu(const fpa::FpaCorrimuPayload& payload,
                        rclcpp::Publisher<sensor_msgs::msg::Imu>::SharedPtr& pub) {
     if (pub->get_subscription_count() > 0) {
-        sensor_msgs::msg::Imu msg;
-        FpaImuPayloadToRos(payload, msg);
-        pub->publish(msg);
+        PublishMaybeLoaned(*pub, [&payload](sensor_msgs::msg::Imu& msg) {
+            msg = sensor_msgs::msg::Imu();
+            FpaImuPayloadToRos(payload, msg);
+        });
     }
 }
 
@@ -795,13 +815,14 @@ void PublishNmeaEpochData(const NmeaEpochData& data, rclcpp::Publisher<fpmsgs::N
 
 void PublishOdometryData(const OdometryData& data, rclcpp::Publisher<nav_msgs::msg::Odometry>::SharedPtr& pub) {
     if (pub->get_subscription_count() > 0) {
-        nav_msgs::msg::Odometry msg;
-        msg.header.stamp = ros2::utils::ConvTime(data.stamp);
-        msg.header.frame_id = data.frame_id;
-        msg.child_frame_id = data.child_frame_id;
-        PoseWithCovDataToMsg(data.pose, msg.pose);
-        TwistWithCovDataToMsg(data.twist, msg.twist);
-        pub->publish(msg);
+        PublishMaybeLoaned(*pub, [&data](nav_msgs::msg::Odometry& msg) {
+            msg = nav_msgs::msg::Odometry();
+            msg.header.stamp = ros2::utils::ConvTime(data.stamp);
+            msg.header.frame_id = data.frame_id;
+            msg.child_frame_id = data.child_frame_id;
+            PoseWithCovDataToMsg(data.pose, msg.pose);
+            TwistWithCovDataToMsg(data.twist, msg.twist);
+        });
     }
 }
 
@@ -852,5 +873,40 @@ void PublishFusionEpochData(const FusionEpochData& data, rclcpp::Publisher<fpmsg
         pub->publish(msg);
     }
 }
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+static void LatencyStatsToMsg(const LatencyHistogram::Stats& stats, fpmsgs::DriverLatency& msg) {
+    msg.count = stats.count_;
+    msg.p50 = stats.p50_;
+    msg.p99 = stats.p99_;
+    msg.max = stats.max_;
+}
+
+void PublishDriverStats(const FixpositionDriver::Stats& stats, const TfThrottle::Stats& tf_stats,
+                        const rclcpp::Time& stamp, rclcpp::Publisher<fpmsgs::DriverStats>::SharedPtr& pub) {
+    if (pub->get_subscription_count() > 0) {
+        fpmsgs::DriverStats msg;
+        msg.header.stamp = stamp;
+        msg.read_num_reads = stats.read_.num_reads_;
+        msg.read_num_bytes = stats.read_.num_bytes_;
+        msg.read_max_read = stats.read_.max_read_;
+        msg.queue_depth = stats.queue_.depth_;
+        msg.queue_watermark = stats.queue_.high_watermark_;
+        msg.queue_dropped = stats.queue_.num_dropped_;
+        msg.queue_skipped = stats.queue_.num_skipped_;
+        msg.queue_decimated = stats.queue_.num_decimated_;
+        msg.tf_num_sent = tf_stats.num_sent_;
+        msg.tf_num_suppressed = tf_stats.num_suppressed_;
+        msg.tx_num_sent = stats.tx_.num_sent_;
+        msg.tx_num_dropped = stats.tx_.num_dropped_;
+        msg.tx_num_failed = stats.tx_.num_failed_;
+        LatencyStatsToMsg(stats.latency_.parse_, msg.parse_latency);
+        LatencyStatsToMsg(stats.latency_.dispatch_fpa_, msg.fpa_latency);
+        LatencyStatsToMsg(stats.latency_.dispatch_nmea_, msg.nmea_latency);
+        LatencyStatsToMsg(stats.latency_.dispatch_novb_, msg.novb_latency);
+        pub->publish(msg);
+    }
+}
 /* ****************************************************************************************************************** */
 }  // namespace fixposition
@@ -12,12 +12,16 @@
  */
 
 /* LIBC/STL */
+#include <algorithm>
 #include <chrono>
+#include <cinttypes>
 #include <cstdlib>
 #include <cstring>
 #include <functional>
 #include <future>
 #include <memory>
+#include <thread>
+#include <utility>
 #include <vector>
 
 /* EXTERNAL */
@@ -46,6 +50,7 @@ FixpositionDriverNode::FixpositionDriverNode(std::shared_ptr<rclcpp::Node> nh,
     logger_            { nh_->get_logger() },
     driver_            { params },
     qos_settings_      { rclcpp::QoS(rclcpp::KeepLast(10), rmw_qos_profile_default) },
+    tf_throttle_       { params_.tf_epsilon_trans_, params_.tf_epsilon_rot_, params_.tf_max_rate_ },
     nmea_epoch_data_   { params_.nmea_epoch_ }  // clang-format on
 
 {
@@ -72,12 +77,14 @@ FixpositionDriverNode::~FixpositionDriverNode() {}
 
 // ---------------------------------------------------------------------------------------------------------------------
 
-// Helper for advertising output topics
-#define _PUB(_pub_, _type_, _topic_, ...)                                      \
-    do {                                                                       \
-        RCLCPP_INFO(logger_, "Advertise %s (" #_type_ ")", (_topic_).c_str()); \
-        _pub_ = nh_->create_publisher<_type_>(_topic_, __VA_ARGS__);           \
-    } while (0)
+// Helper for advertising output topics. The publisher is not created here but queued as a job for SetupRos(), which
+// runs in a background thread after the driver has been started (create_publisher() triggers DDS discovery work,
+// which must not hold up the sensor data flow).
+#define _PUB(_pub_, _type_, _topic_, ...)                                          \
+    advertise_jobs_.push_back([this, topic = (_topic_)]() {                        \
+        RCLCPP_INFO(logger_, "Advertise %s (" #_type_ ")", topic.c_str());         \
+        _pub_ = nh_->create_publisher<_type_>(topic, __VA_ARGS__);                 \
+    })
 
 // Helper for subscribing to input topics
 #define _SUB(_sub_, _type_, _topic_, ...)                                      \
@@ -88,85 +95,108 @@ FixpositionDriverNode::~FixpositionDriverNode() {}
 
 bool FixpositionDriverNode::StartNode() {
     RCLCPP_INFO(logger_, "Starting...");
+    start_time_ = std::chrono::steady_clock::now();
+    ros_ready_ = false;
+    first_msg_logged_ = false;
 
-    // TF
-    tf_br_ = std::make_unique<tf2_ros::TransformBroadcaster>(nh_);
-    static_br_ = std::make_unique<tf2_ros::StaticTransformBroadcaster>(nh_);
-
-    // Add observers and advertise output topics, depending on configuration
+    // Add observers and queue the advertising of the output topics, depending on configuration
     const std::string output_ns = (params_.output_ns_.empty() ? nh_->get_namespace() : params_.output_ns_);
 
+    // In epoch batching mode the per-epoch messages are only collected and published as one aggregate message per
+    // epoch (fusion resp. nmea topics, triggered by FP_A-EOE below), instead of one DDS publish per message
+    const bool batching = params_.epoch_batching_;
+
     // FP_A-ODOMETRY
     if (params_.MessageEnabled(fpa::FpaOdometryPayload::MSG_NAME)) {
-        _PUB(fpa_odometry_pub_, fpmsgs::FpaOdometry, output_ns + "/fpa/odometry", qos_settings_);
-        _PUB(odometry_ecef_pub_, nav_msgs::msg::Odometry, output_ns + "/odometry_ecef", qos_settings_);
-        _PUB(odometry_llh_pub_, sensor_msgs::msg::NavSatFix, output_ns + "/odometry_llh", qos_settings_);
-        _PUB(poiimu_pub_, sensor_msgs::msg::Imu, output_ns + "/poiimu", qos_settings_);
-        driver_.AddFpaObserver(fpa::FpaOdometryPayload::MSG_NAME, [this](const fpa::FpaPayload& payload) {
-            auto odometry_payload = dynamic_cast<const fpa::FpaOdometryPayload&>(payload);
-            PublishFpaOdometry(odometry_payload, fpa_odometry_pub_);
-            PublishFpaOdometryDataImu(odometry_payload, poiimu_pub_);
-            PublishFpaOdometryDataNavSatFix(odometry_payload, odometry_llh_pub_);
+        if (!batching) {
+            _PUB(fpa_odometry_pub_, fpmsgs::FpaOdometry, output_ns + "/fpa/odometry", qos_settings_);
+            _PUB(odometry_ecef_pub_, nav_msgs::msg::Odometry, output_ns + "/odometry_ecef", qos_settings_);
+            _PUB(odometry_llh_pub_, sensor_msgs::msg::NavSatFix, output_ns + "/odometry_llh", qos_settings_);
+            _PUB(poiimu_pub_, sensor_msgs::msg::Imu, output_ns + "/poiimu", qos_settings_);
+        }
+        driver_.AddFpaObserver<fpa::FpaOdometryPayload>([this](const fpa::FpaOdometryPayload& odometry_payload) {
+            if (!RosReady()) { return; }
             OdometryData odometry_data;
             odometry_data.SetFromFpaOdomPayload(odometry_payload);
-            PublishOdometryData(odometry_data, odometry_ecef_pub_);
+            if (!params_.epoch_batching_) {
+                PublishFpaOdometry(odometry_payload, fpa_odometry_pub_);
+                PublishFpaOdometryDataImu(odometry_payload, poiimu_pub_);
+                PublishFpaOdometryDataNavSatFix(odometry_payload, odometry_llh_pub_);
+                PublishOdometryData(odometry_data, odometry_ecef_pub_);
+            }
             ProcessOdometryData(odometry_data);
-            fusion_epoch_data_.CollectFpaOdometry(odometry_payload);
+            std::unique_lock<std::mutex> lock(epoch_mutex_);
+            fusion_epoch_data_.Active().CollectFpaOdometry(odometry_payload);
         });
     }
 
     // FP_A-ODOMSH
     if (params_.MessageEnabled(fpa::FpaOdomshPayload::MSG_NAME)) {
-        _PUB(fpa_odomsh_pub_, fpmsgs::FpaOdomsh, output_ns + "/fpa/odomsh", qos_settings_);
-        _PUB(odometry_smooth_pub_, nav_msgs::msg::Odometry, output_ns + "/odometry_smooth", qos_settings_);
-        driver_.AddFpaObserver(fpa::FpaOdomshPayload::MSG_NAME, [this](const fpa::FpaPayload& payload) {
-            auto odomsh_payload = dynamic_cast<const fpa::FpaOdomshPayload&>(payload);
-            PublishFpaOdomsh(odomsh_payload, fpa_odomsh_pub_);
+        if (!batching) {
+            _PUB(fpa_odomsh_pub_, fpmsgs::FpaOdomsh, output_ns + "/fpa/odomsh", qos_settings_);
+            _PUB(odometry_smooth_pub_, nav_msgs::msg::Odometry, output_ns + "/odometry_smooth", qos_settings_);
+        }
+        driver_.AddFpaObserver<fpa::FpaOdomshPayload>([this](const fpa::FpaOdomshPayload& odomsh_payload) {
+            if (!RosReady()) { return; }
             OdometryData odometry_data;
             odometry_data.SetFromFpaOdomPayload(odomsh_payload);
-            PublishOdometryData(odometry_data, odometry_smooth_pub_);
+            if (!params_.epoch_batching_) {
+                PublishFpaOdomsh(odomsh_payload, fpa_odomsh_pub_);
+                PublishOdometryData(odometry_data, odometry_smooth_pub_);
+            }
             ProcessOdometryData(odometry_data);
-            fusion_epoch_data_.CollectFpaOdomsh(odomsh_payload);
+            std::unique_lock<std::mutex> lock(epoch_mutex_);
+            fusion_epoch_data_.Active().CollectFpaOdomsh(odomsh_payload);
         });
     }
 
     // FP_A-ODOMENU
     if (params_.MessageEnabled(fpa::FpaOdomenuPayload::MSG_NAME)) {
-        _PUB(fpa_odomenu_pub_, fpmsgs::FpaOdomenu, output_ns + "/fpa/odomenu", qos_settings_);
-        _PUB(odometry_enu_pub_, nav_msgs::msg::Odometry, output_ns + "/odometry_enu", qos_settings_);
-        _PUB(eul_pub_, geometry_msgs::msg::Vector3Stamped, output_ns + "/ypr", qos_settings_);
-        driver_.AddFpaObserver(fpa::FpaOdomenuPayload::MSG_NAME, [this](const fpa::FpaPayload& payload) {
-            auto odomenu_payload = dynamic_cast<const fpa::FpaOdomenuPayload&>(payload);
-            PublishFpaOdomenu(odomenu_payload, fpa_odomenu_pub_);
-            PublishFpaOdomenuVector3Stamped(odomenu_payload, eul_pub_);
+        if (!batching) {
+            _PUB(fpa_odomenu_pub_, fpmsgs::FpaOdomenu, output_ns + "/fpa/odomenu", qos_settings_);
+            _PUB(odometry_enu_pub_, nav_msgs::msg::Odometry, output_ns + "/odometry_enu", qos_settings_);
+            _PUB(eul_pub_, geometry_msgs::msg::Vector3Stamped, output_ns + "/ypr", qos_settings_);
+        }
+        driver_.AddFpaObserver<fpa::FpaOdomenuPayload>([this](const fpa::FpaOdomenuPayload& odomenu_payload) {
+            if (!RosReady()) { return; }
             OdometryData odometry_data;
             odometry_data.SetFromFpaOdomPayload(odomenu_payload);
-            PublishOdometryData(odometry_data, odometry_enu_pub_);
+            if (!params_.epoch_batching_) {
+                PublishFpaOdomenu(odomenu_payload, fpa_odomenu_pub_);
+                PublishFpaOdomenuVector3Stamped(odomenu_payload, eul_pub_);
+                PublishOdometryData(odometry_data, odometry_enu_pub_);
+            }
             ProcessOdometryData(odometry_data);
-            fusion_epoch_data_.CollectFpaOdomenu(odomenu_payload);
+            std::unique_lock<std::mutex> lock(epoch_mutex_);
+            fusion_epoch_data_.Active().CollectFpaOdomenu(odomenu_payload);
         });
     }
 
     // FP_A-ODOMSTATUS
     if (params_.MessageEnabled(fpa::FpaOdomstatusPayload::MSG_NAME)) {
-        _PUB(fpa_odomstatus_pub_, fpmsgs::FpaOdomstatus, output_ns + "/fpa/odomstatus", qos_settings_);
-        driver_.AddFpaObserver(fpa::FpaOdomstatusPayload::MSG_NAME, [this](const fpa::FpaPayload& payload) {
-            auto odomstatus_payload = dynamic_cast<const fpa::FpaOdomstatusPayload&>(payload);
-            PublishFpaOdomstatus(odomstatus_payload, fpa_odomstatus_pub_);
-            fusion_epoch_data_.CollectFpaOdomstatus(odomstatus_payload);
+        if (!batching) {
+            _PUB(fpa_odomstatus_pub_, fpmsgs::FpaOdomstatus, output_ns + "/fpa/odomstatus", qos_settings_);
+        }
+        driver_.AddFpaObserver<fpa::FpaOdomstatusPayload>([this](const fpa::FpaOdomstatusPayload& odomstatus_payload) {
+            if (!RosReady()) { return; }
+            if (!params_.epoch_batching_) {
+                PublishFpaOdomstatus(odomstatus_payload, fpa_odomstatus_pub_);
+            }
+            std::unique_lock<std::mutex> lock(epoch_mutex_);
+            fusion_epoch_data_.Active().CollectFpaOdomstatus(odomstatus_payload);
         });
     }
 
     // FP_A-EOE
     if (params_.MessageEnabled(fpa::FpaEoePayload::MSG_NAME)) {
         _PUB(fpa_eoe_pub_, fpmsgs::FpaEoe, output_ns + "/fpa/eoe", qos_settings_);
-        driver_.AddFpaObserver(fpa::FpaEoePayload::MSG_NAME, [this](const fpa::FpaPayload& payload) {
-            auto eoe_payload = dynamic_cast<const fpa::FpaEoePayload&>(payload);
-            (void)eoe_payload;
+        driver_.AddFpaObserver<fpa::FpaEoePayload>([this](const fpa::FpaEoePayload& eoe_payload) {
+            if (!RosReady()) { return; }
             PublishFpaEoe(eoe_payload, fpa_eoe_pub_);
+            std::unique_lock<std::mutex> lock(epoch_mutex_);
             if (eoe_payload.epoch == fpa::FpaEpoch::FUSION) {
                 // Fusion epoch
-                PublishFusionEpochData(fusion_epoch_data_.CompleteAndReset(eoe_payload), fusion_epoch_pub_);
+                PublishFusionEpochData(fusion_epoch_data_.CompleteAndSwap(eoe_payload), fusion_epoch_pub_);
                 // Generate Nav2 TF tree
                 if (params_.nav2_mode_) {
                     PublishNav2Tf();
@@ -175,7 +205,7 @@ bool FixpositionDriverNode::StartNode() {
 
             // NMEA epoch (which can be FUSION, too)
             if (params_.nmea_epoch_ == eoe_payload.epoch) {
-                PublishNmeaEpochData(nmea_epoch_data_.CompleteAndReset(), nmea_epoch_pub_);
+                PublishNmeaEpochData(nmea_epoch_data_.CompleteAndSwap(), nmea_epoch_pub_);
             }
         });
     }
@@ -183,10 +213,10 @@ bool FixpositionDriverNode::StartNode() {
     // FP_A-TF
     if (params_.MessageEnabled(fpa::FpaTfPayload::MSG_NAME)) {
         _PUB(eul_imu_pub_, geometry_msgs::msg::Vector3Stamped, output_ns + "/imu_ypr", qos_settings_);
-        driver_.AddFpaObserver(fpa::FpaTfPayload::MSG_NAME, [this](const fpa::FpaPayload& payload) {
-            (void)payload;
+        driver_.AddFpaObserver<fpa::FpaTfPayload>([this](const fpa::FpaTfPayload& payload) {
+            if (!RosReady()) { return; }
             TfData tf;
-            tf.SetFromFpaTfPayload(dynamic_cast<const fpa::FpaTfPayload&>(payload));
+            tf.SetFromFpaTfPayload(payload);
             ProcessTfData(tf);
         });
     }
@@ -194,66 +224,78 @@ bool FixpositionDriverNode::StartNode() {
     // FP_A-LLH
     if (params_.MessageEnabled(fpa::FpaLlhPayload::MSG_NAME)) {
         _PUB(fpa_llh_pub_, fpmsgs::FpaLlh, output_ns + "/fpa/llh", qos_settings_);
-        driver_.AddFpaObserver(fpa::FpaLlhPayload::MSG_NAME, [this](const fpa::FpaPayload& payload) {
-            PublishFpaLlh(dynamic_cast<const fpa::FpaLlhPayload&>(payload), fpa_llh_pub_);
+        driver_.AddFpaObserver<fpa::FpaLlhPayload>([this](const fpa::FpaLlhPayload& payload) {
+            if (!RosReady()) { return; }
+            PublishFpaLlh(payload, fpa_llh_pub_);
         });
     }
 
     // FP_A-GNSSANT
     if (params_.MessageEnabled(fpa::FpaGnssantPayload::MSG_NAME)) {
         _PUB(fpa_gnssant_pub_, fpmsgs::FpaGnssant, output_ns + "/fpa/gnssant", qos_settings_);
-        driver_.AddFpaObserver(fpa::FpaGnssantPayload::MSG_NAME, [this](const fpa::FpaPayload& payload) {
-            PublishFpaGnssant(dynamic_cast<const fpa::FpaGnssantPayload&>(payload), fpa_gnssant_pub_);
+        driver_.AddFpaObserver<fpa::FpaGnssantPayload>([this](const fpa::FpaGnssantPayload& payload) {
+            if (!RosReady()) { return; }
+            PublishFpaGnssant(payload, fpa_gnssant_pub_);
         });
     }
 
     // FP_A-GNSSCORR
     if (params_.MessageEnabled(fpa::FpaGnsscorrPayload::MSG_NAME)) {
         _PUB(fpa_gnsscorr_pub_, fpmsgs::FpaGnsscorr, output_ns + "/fpa/gnsscorr", qos_settings_);
-        driver_.AddFpaObserver(fpa::FpaGnsscorrPayload::MSG_NAME, [this](const fpa::FpaPayload& payload) {
-            PublishFpaGnsscorr(dynamic_cast<const fpa::FpaGnsscorrPayload&>(payload), fpa_gnsscorr_pub_);
+        driver_.AddFpaObserver<fpa::FpaGnsscorrPayload>([this](const fpa::FpaGnsscorrPayload& payload) {
+            if (!RosReady()) { return; }
+            PublishFpaGnsscorr(payload, fpa_gnsscorr_pub_);
         });
     }
 
     // FP_A-IMUBIAS
     if (params_.MessageEnabled(fpa::FpaImubiasPayload::MSG_NAME)) {
-        _PUB(fpa_imubias_pub_, fpmsgs::FpaImubias, output_ns + "/fpa/imubias", qos_settings_);
-        driver_.AddFpaObserver(fpa::FpaImubiasPayload::MSG_NAME, [this](const fpa::FpaPayload& payload) {
-            auto imubias_payload = dynamic_cast<const fpa::FpaImubiasPayload&>(payload);
-            PublishFpaImubias(imubias_payload, fpa_imubias_pub_);
-            fusion_epoch_data_.CollectFpaImubias(imubias_payload);
+        if (!batching) {
+            _PUB(fpa_imubias_pub_, fpmsgs::FpaImubias, output_ns + "/fpa/imubias", qos_settings_);
+        }
+        driver_.AddFpaObserver<fpa::FpaImubiasPayload>([this](const fpa::FpaImubiasPayload& imubias_payload) {
+            if (!RosReady()) { return; }
+            if (!params_.epoch_batching_) {
+                PublishFpaImubias(imubias_payload, fpa_imubias_pub_);
+            }
+            std::unique_lock<std::mutex> lock(epoch_mutex_);
+            fusion_epoch_data_.Active().CollectFpaImubias(imubias_payload);
         });
     }
 
     // FP_A-RAWIMU
     if (params_.MessageEnabled(fpa::FpaRawimuPayload::MSG_NAME)) {
         _PUB(rawimu_pub_, sensor_msgs::msg::Imu, output_ns + "/fpa/rawimu", qos_settings_);
-        driver_.AddFpaObserver(fpa::FpaRawimuPayload::MSG_NAME, [this](const fpa::FpaPayload& payload) {
-            PublishFpaRawimu(dynamic_cast<const fpa::FpaRawimuPayload&>(payload), rawimu_pub_);
+        driver_.AddFpaObserver<fpa::FpaRawimuPayload>([this](const fpa::FpaRawimuPayload& payload) {
+            if (!RosReady()) { return; }
+            PublishFpaRawimu(payload, rawimu_pub_);
         });
     }
 
     // FP_A-CORRIMU
     if (params_.MessageEnabled(fpa::FpaCorrimuPayload::MSG_NAME)) {
         _PUB(corrimu_pub_, sensor_msgs::msg::Imu, output_ns + "/fpa/corrimu", qos_settings_);
-        driver_.AddFpaObserver(fpa::FpaCorrimuPayload::MSG_NAME, [this](const fpa::FpaPayload& payload) {
-            PublishFpaCorrimu(dynamic_cast<const fpa::FpaCorrimuPayload&>(payload), corrimu_pub_);
+        driver_.AddFpaObserver<fpa::FpaCorrimuPayload>([this](const fpa::FpaCorrimuPayload& payload) {
+            if (!RosReady()) { return; }
+            PublishFpaCorrimu(payload, corrimu_pub_);
         });
     }
 
     // FP_A-TEXT
     if (params_.MessageEnabled(fpa::FpaTextPayload::MSG_NAME)) {
         _PUB(fpa_text_pub_, fpmsgs::FpaText, output_ns + "/fpa/text", qos_settings_);
-        driver_.AddFpaObserver(fpa::FpaTextPayload::MSG_NAME, [this](const fpa::FpaPayload& payload) {
-            PublishFpaText(dynamic_cast<const fpa::FpaTextPayload&>(payload), fpa_text_pub_);
+        driver_.AddFpaObserver<fpa::FpaTextPayload>([this](const fpa::FpaTextPayload& payload) {
+            if (!RosReady()) { return; }
+            PublishFpaText(payload, fpa_text_pub_);
         });
     }
 
     // FP_A-TP
     if (params_.MessageEnabled(fpa::FpaTpPayload::MSG_NAME)) {
         _PUB(fpa_tp_pub_, fpmsgs::FpaTp, output_ns + "/fpa/tp", qos_settings_);
-        driver_.AddFpaObserver(fpa::FpaTpPayload::MSG_NAME, [this](const fpa::FpaPayload& payload) {
-            PublishFpaTp(dynamic_cast<const fpa::FpaTpPayload&>(payload), fpa_tp_pub_);
+        driver_.AddFpaObserver<fpa::FpaTpPayload>([this](const fpa::FpaTpPayload& payload) {
+            if (!RosReady()) { return; }
+            PublishFpaTp(payload, fpa_tp_pub_);
         });
     }
 
@@ -263,6 +305,7 @@ bool FixpositionDriverNode::StartNode() {
         _PUB(navsatfix_gnss2_pub_, sensor_msgs::msg::NavSatFix, output_ns + "/gnss2", qos_settings_);
         driver_.AddNovbObserver(  //
             novb::NOV_B_BESTGNSSPOS_STRID, [this](const novb::NovbHeader* header, const uint8_t* payload) {
+                if (!RosReady()) { return; }
                 if (!PublishNovbBestgnsspos(header, (novb::NovbBestgnsspos*)payload, navsatfix_gnss1_pub_,
                                             navsatfix_gnss2_pub_)) {
                     RCLCPP_WARN_THROTTLE(logger_, *nh_->get_clock(), 1e3, "Bad NOV_B-BESTGNSSPOS");
@@ -272,111 +315,165 @@ bool FixpositionDriverNode::StartNode() {
 
     // NOV_B-INSPVAX
     if (params_.MessageEnabled(novb::NOV_B_INSPVAX_STRID)) {
-        _PUB(novb_inspvax_pub_, fpmsgs::NovbInspvax, output_ns + "/novb/inspvax", qos_settings_);
+        if (!batching) {
+            _PUB(novb_inspvax_pub_, fpmsgs::NovbInspvax, output_ns + "/novb/inspvax", qos_settings_);
+        }
         driver_.AddNovbObserver(  //
             novb::NOV_B_INSPVAX_STRID, [this](const novb::NovbHeader* header, const uint8_t* payload) {
-                if (!PublishNovbInspvax(header, (novb::NovbInspvax*)payload, novb_inspvax_pub_)) {
+                if (!RosReady()) { return; }
+                if (!params_.epoch_batching_ &&
+                    !PublishNovbInspvax(header, (novb::NovbInspvax*)payload, novb_inspvax_pub_)) {
                     RCLCPP_WARN_THROTTLE(logger_, *nh_->get_clock(), 1e3, "Bad NOV_B-INSPVAX");
                 }
-                fusion_epoch_data_.CollectNovbInspvax(header, (novb::NovbInspvax*)payload);
+                std::unique_lock<std::mutex> lock(epoch_mutex_);
+                fusion_epoch_data_.Active().CollectNovbInspvax(header, (novb::NovbInspvax*)payload);
             });
     }
 
     // NMEA-GP-GGA
     if (params_.MessageEnabled(nmea::NmeaGgaPayload::FORMATTER)) {
-        _PUB(nmea_gga_pub_, fpmsgs::NmeaGga, output_ns + "/nmea/gga", qos_settings_);
-        driver_.AddNmeaObserver(nmea::NmeaGgaPayload::FORMATTER, [this](const nmea::NmeaPayload& payload) {
-            auto gga_payload = dynamic_cast<const nmea::NmeaGgaPayload&>(payload);
-            PublishNmeaGga(gga_payload, nmea_gga_pub_);
-            nmea_epoch_data_.gga_ = gga_payload;
+        if (!batching) {
+            _PUB(nmea_gga_pub_, fpmsgs::NmeaGga, output_ns + "/nmea/gga", qos_settings_);
+        }
+        driver_.SetNmeaConsumer<nmea::NmeaGgaPayload>([this](nmea::NmeaGgaPayload&& gga_payload) {
+            if (!RosReady()) { return; }
+            if (!params_.epoch_batching_) {
+                PublishNmeaGga(gga_payload, nmea_gga_pub_);
+            }
+            std::unique_lock<std::mutex> lock(epoch_mutex_);
+            nmea_epoch_data_.Active().gga_ = std::move(gga_payload);
         });
     }
 
     // NMEA-GP-GLL
     if (params_.MessageEnabled(nmea::NmeaGllPayload::FORMATTER)) {
-        _PUB(nmea_gll_pub_, fpmsgs::NmeaGll, output_ns + "/nmea/gll", qos_settings_);
-        driver_.AddNmeaObserver(nmea::NmeaGllPayload::FORMATTER, [this](const nmea::NmeaPayload& payload) {
-            auto gll_payload = dynamic_cast<const nmea::NmeaGllPayload&>(payload);
-            PublishNmeaGll(gll_payload, nmea_gll_pub_);
-            nmea_epoch_data_.gll_ = gll_payload;
+        if (!batching) {
+            _PUB(nmea_gll_pub_, fpmsgs::NmeaGll, output_ns + "/nmea/gll", qos_settings_);
+        }
+        driver_.SetNmeaConsumer<nmea::NmeaGllPayload>([this](nmea::NmeaGllPayload&& gll_payload) {
+            if (!RosReady()) { return; }
+            if (!params_.epoch_batching_) {
+                PublishNmeaGll(gll_payload, nmea_gll_pub_);
+            }
+            std::unique_lock<std::mutex> lock(epoch_mutex_);
+            nmea_epoch_data_.Active().gll_ = std::move(gll_payload);
         });
     }
 
     // NMEA-GN-GSA
     if (params_.MessageEnabled(nmea::NmeaGsaPayload::FORMATTER)) {
-        _PUB(nmea_gsa_pub_, fpmsgs::NmeaGsa, output_ns + "/nmea/gsa", qos_settings_);
-        driver_.AddNmeaObserver(nmea::NmeaGsaPayload::FORMATTER, [this](const nmea::NmeaPayload& payload) {
-            auto gsa_payload_ = dynamic_cast<const nmea::NmeaGsaPayload&>(payload);
-            PublishNmeaGsa(gsa_payload_, nmea_gsa_pub_);
-            nmea_epoch_data_.gsa_ = gsa_payload_;
-            nmea_epoch_data_.gsa_gsv_.AddGsa(gsa_payload_);
+        if (!batching) {
+            _PUB(nmea_gsa_pub_, fpmsgs::NmeaGsa, output_ns + "/nmea/gsa", qos_settings_);
+        }
+        driver_.SetNmeaConsumer<nmea::NmeaGsaPayload>([this](nmea::NmeaGsaPayload&& gsa_payload_) {
+            if (!RosReady()) { return; }
+            if (!params_.epoch_batching_) {
+                PublishNmeaGsa(gsa_payload_, nmea_gsa_pub_);
+            }
+            std::unique_lock<std::mutex> lock(epoch_mutex_);
+            nmea_epoch_data_.Active().gsa_gsv_.AddGsa(gsa_payload_);
+            nmea_epoch_data_.Active().gsa_ = std::move(gsa_payload_);
         });
     }
 
     // NMEA-GP-GST
     if (params_.MessageEnabled(nmea::NmeaGstPayload::FORMATTER)) {
-        _PUB(nmea_gst_pub_, fpmsgs::NmeaGst, output_ns + "/nmea/gst", qos_settings_);
-        driver_.AddNmeaObserver(nmea::NmeaGstPayload::FORMATTER, [this](const nmea::NmeaPayload& payload) {
-            auto gst_payload = dynamic_cast<const nmea::NmeaGstPayload&>(payload);
-            PublishNmeaGst(gst_payload, nmea_gst_pub_);
-            nmea_epoch_data_.gst_ = gst_payload;
+        if (!batching) {
+            _PUB(nmea_gst_pub_, fpmsgs::NmeaGst, output_ns + "/nmea/gst", qos_settings_);
+        }
+        driver_.SetNmeaConsumer<nmea::NmeaGstPayload>([this](nmea::NmeaGstPayload&& gst_payload) {
+            if (!RosReady()) { return; }
+            if (!params_.epoch_batching_) {
+                PublishNmeaGst(gst_payload, nmea_gst_pub_);
+            }
+            std::unique_lock<std::mutex> lock(epoch_mutex_);
+            nmea_epoch_data_.Active().gst_ = std::move(gst_payload);
         });
     }
 
     // NMEA-GX-GSV
     if (params_.MessageEnabled(nmea::NmeaGsvPayload::FORMATTER)) {
-        _PUB(nmea_gsv_pub_, fpmsgs::NmeaGsv, output_ns + "/nmea/gsv", qos_settings_);
-        driver_.AddNmeaObserver(nmea::NmeaGsvPayload::FORMATTER, [this](const nmea::NmeaPayload& payload) {
-            auto gsv_payload_ = dynamic_cast<const nmea::NmeaGsvPayload&>(payload);
-            PublishNmeaGsv(gsv_payload_, nmea_gsv_pub_);
-            nmea_epoch_data_.gsa_gsv_.AddGsv(gsv_payload_);
+        if (!batching) {
+            _PUB(nmea_gsv_pub_, fpmsgs::NmeaGsv, output_ns + "/nmea/gsv", qos_settings_);
+        }
+        driver_.SetNmeaConsumer<nmea::NmeaGsvPayload>([this](nmea::NmeaGsvPayload&& gsv_payload_) {
+            if (!RosReady()) { return; }
+            if (!params_.epoch_batching_) {
+                PublishNmeaGsv(gsv_payload_, nmea_gsv_pub_);
+            }
+            std::unique_lock<std::mutex> lock(epoch_mutex_);
+            nmea_epoch_data_.Active().gsa_gsv_.AddGsv(gsv_payload_);
         });
     }
 
     // NMEA-GP-HDT
     if (params_.MessageEnabled(nmea::NmeaHdtPayload::FORMATTER)) {
-        _PUB(nmea_hdt_pub_, fpmsgs::NmeaHdt, output_ns + "/nmea/hdt", qos_settings_);
-        driver_.AddNmeaObserver(nmea::NmeaHdtPayload::FORMATTER, [this](const nmea::NmeaPayload& payload) {
-            auto hdt_payload = dynamic_cast<const nmea::NmeaHdtPayload&>(payload);
-            PublishNmeaHdt(hdt_payload, nmea_hdt_pub_);
-            nmea_epoch_data_.hdt_ = hdt_payload;
+        if (!batching) {
+            _PUB(nmea_hdt_pub_, fpmsgs::NmeaHdt, output_ns + "/nmea/hdt", qos_settings_);
+        }
+        driver_.SetNmeaConsumer<nmea::NmeaHdtPayload>([this](nmea::NmeaHdtPayload&& hdt_payload) {
+            if (!RosReady()) { return; }
+            if (!params_.epoch_batching_) {
+                PublishNmeaHdt(hdt_payload, nmea_hdt_pub_);
+            }
+            std::unique_lock<std::mutex> lock(epoch_mutex_);
+            nmea_epoch_data_.Active().hdt_ = std::move(hdt_payload);
         });
     }
 
     // NMEA-GP-RMC
     if (params_.MessageEnabled(nmea::NmeaRmcPayload::FORMATTER)) {
-        _PUB(nmea_rmc_pub_, fpmsgs::NmeaRmc, output_ns + "/nmea/rmc", qos_settings_);
-        driver_.AddNmeaObserver(nmea::NmeaRmcPayload::FORMATTER, [this](const nmea::NmeaPayload& payload) {
-            auto rmc_payload = dynamic_cast<const nmea::NmeaRmcPayload&>(payload);
-            PublishNmeaRmc(rmc_payload, nmea_rmc_pub_);
-            nmea_epoch_data_.rmc_ = rmc_payload;
+        if (!batching) {
+            _PUB(nmea_rmc_pub_, fpmsgs::NmeaRmc, output_ns + "/nmea/rmc", qos_settings_);
+        }
+        driver_.SetNmeaConsumer<nmea::NmeaRmcPayload>([this](nmea::NmeaRmcPayload&& rmc_payload) {
+            if (!RosReady()) { return; }
+            if (!params_.epoch_batching_) {
+                PublishNmeaRmc(rmc_payload, nmea_rmc_pub_);
+            }
+            std::unique_lock<std::mutex> lock(epoch_mutex_);
+            nmea_epoch_data_.Active().rmc_ = std::move(rmc_payload);
         });
     }
 
     // NMEA-GP-VTG
     if (params_.MessageEnabled(nmea::NmeaVtgPayload::FORMATTER)) {
-        _PUB(nmea_vtg_pub_, fpmsgs::NmeaVtg, output_ns + "/nmea/vtg", qos_settings_);
-        driver_.AddNmeaObserver(nmea::NmeaVtgPayload::FORMATTER, [this](const nmea::NmeaPayload& payload) {
-            auto vtg_payload = dynamic_cast<const nmea::NmeaVtgPayload&>(payload);
-            PublishNmeaVtg(vtg_payload, nmea_vtg_pub_);
-            nmea_epoch_data_.vtg_ = vtg_payload;
+        if (!batching) {
+            _PUB(nmea_vtg_pub_, fpmsgs::NmeaVtg, output_ns + "/nmea/vtg", qos_settings_);
+        }
+        driver_.SetNmeaConsumer<nmea::NmeaVtgPayload>([this](nmea::NmeaVtgPayload&& vtg_payload) {
+            if (!RosReady()) { return; }
+            if (!params_.epoch_batching_) {
+                PublishNmeaVtg(vtg_payload, nmea_vtg_pub_);
+            }
+            std::unique_lock<std::mutex> lock(epoch_mutex_);
+            nmea_epoch_data_.Active().vtg_ = std::move(vtg_payload);
         });
     }
 
     // NMEA-GP-ZDA
     if (params_.MessageEnabled(nmea::NmeaZdaPayload::FORMATTER)) {
-        _PUB(nmea_zda_pub_, fpmsgs::NmeaZda, output_ns + "/nmea/zda", qos_settings_);
-        driver_.AddNmeaObserver(nmea::NmeaZdaPayload::FORMATTER, [this](const nmea::NmeaPayload& payload) {
-            auto zda_payload = dynamic_cast<const nmea::NmeaZdaPayload&>(payload);
-            PublishNmeaZda(zda_payload, nmea_zda_pub_);
-            nmea_epoch_data_.zda_ = zda_payload;
+        if (!batching) {
+            _PUB(nmea_zda_pub_, fpmsgs::NmeaZda, output_ns + "/nmea/zda", qos_settings_);
+        }
+        driver_.SetNmeaConsumer<nmea::NmeaZdaPayload>([this](nmea::NmeaZdaPayload&& zda_payload) {
+            if (!RosReady()) { return; }
+            if (!params_.epoch_batching_) {
+                PublishNmeaZda(zda_payload, nmea_zda_pub_);
+            }
+            std::unique_lock<std::mutex> lock(epoch_mutex_);
+            nmea_epoch_data_.Active().zda_ = std::move(zda_payload);
         });
     }
 
     // Raw messages
     if (params_.raw_output_) {
         _PUB(raw_pub_, fpmsgs::ParserMsg, output_ns + "/raw", qos_settings_);
-        driver_.AddRawObserver([this](const parser::ParserMsg& msg) { PublishParserMsg(msg, raw_pub_); });
+        driver_.AddRawObserver([this](const parser::ParserMsg& msg) {
+            if (RosReady()) {
+                PublishParserMsg(msg, raw_pub_);
+            }
+        });
     }
 
     // Fusion epoch
@@ -396,17 +493,99 @@ bool FixpositionDriverNode::StartNode() {
         _PUB(jump_pub_, fpmsgs::CovWarn, output_ns + "/extras/jump", qos_settings_);
     }
 
+    // Driver statistics, published at a low rate (counters, queue depths and receive-to-publish latency percentiles,
+    // see FixpositionDriver::GetStats())
+    _PUB(stats_pub_, fpmsgs::DriverStats, output_ns + "/extras/stats", qos_settings_);
+
+    // Start the driver now: sensor data is read, parsed and buffered immediately, while SetupRos() creates the ROS
+    // interface in the background. The observers start publishing as soon as the interface is ready (see RosReady()).
+    if (!driver_.StartDriver()) {
+        return false;
+    }
+    setup_thread_ = std::thread(&FixpositionDriverNode::SetupRos, this);
+    return true;
+}
+
+void FixpositionDriverNode::SetupRos() {
+    // TF
+    tf_br_ = std::make_unique<tf2_ros::TransformBroadcaster>(nh_);
+    static_br_ = std::make_unique<tf2_ros::StaticTransformBroadcaster>(nh_);
+
+    // Create the publishers queued by StartNode()
+    for (auto& job : advertise_jobs_) {
+        job();
+    }
+    advertise_jobs_.clear();
+
+    // Timer for the driver statistics topic queued above
+    stats_timer_ = nh_->create_wall_timer(std::chrono::seconds(1), [this]() {
+        PublishDriverStats(driver_.GetStats(), tf_throttle_.GetStats(), nh_->now(), stats_pub_);
+    });
+
+    // Allow changing the set of enabled messages at runtime without restarting the node, e.g.
+    //     ros2 param set <node> messages "['FP_A-ODOMETRY', 'FP_A-EOE', ...]"
+    // Messages missing from the new list are disabled in the driver (skipped right after framing, so they cost
+    // neither decoding nor publishing, see FixpositionDriver::SetDisabledMessages()) and can be re-enabled the same
+    // way, all without interrupting the sensor connection or the DDS graph. Messages that were not enabled at
+    // startup cannot be enabled at runtime, as their observers and publishers were never created.
+    params_cb_handle_ = nh_->add_on_set_parameters_callback([this](const std::vector<rclcpp::Parameter>& ros_params) {
+        rcl_interfaces::msg::SetParametersResult result;
+        result.successful = true;
+        for (const auto& ros_param : ros_params) {
+            if (ros_param.get_name() != "messages") {
+                continue;
+            }
+            const auto enabled = ros_param.as_string_array();
+            std::vector<std::string> disabled;
+            for (const auto& message : params_.messages_) {
+                if (std::find(enabled.begin(), enabled.end(), message) == enabled.end()) {
+                    disabled.push_back(message);
+                }
+            }
+            for (const auto& message : enabled) {
+                if (!params_.MessageEnabled(message)) {
+                    RCLCPP_WARN(logger_, "Cannot enable message %s at runtime, it was not enabled at startup",
+                                message.c_str());
+                }
+            }
+            RCLCPP_INFO(logger_, "Runtime message set update: %" PRIuMAX " of %" PRIuMAX " configured messages enabled",
+                        params_.messages_.size() - disabled.size(), params_.messages_.size());
+            driver_.SetDisabledMessages(disabled);
+        }
+        return result;
+    });
+
+    // Input subscriptions go into separate (mutually exclusive) callback groups, so that with the multi-threaded
+    // executor a burst of correction data does not delay wheelspeed forwarding (and vice versa). The writes to the
+    // sensor are serialised through driver_mutex_ as the callbacks can now execute concurrently.
+    corr_cbgroup_ = nh_->create_callback_group(rclcpp::CallbackGroupType::MutuallyExclusive);
+    speed_cbgroup_ = nh_->create_callback_group(rclcpp::CallbackGroupType::MutuallyExclusive);
+    rclcpp::SubscriptionOptions corr_opts;
+    corr_opts.callback_group = corr_cbgroup_;
+    rclcpp::SubscriptionOptions speed_opts;
+    speed_opts.callback_group = speed_cbgroup_;
+
     // Subscribe to correction data input
     if (!params_.corr_topic_.empty()) {
-        _SUB(corr_sub_, rtcm_msgs::msg::Message, params_.corr_topic_, 100, [this](const rtcm_msgs::msg::Message& msg) {
-            driver_.SendCorrectionData(msg.message.data(), msg.message.size());
-        });
+        _SUB(
+            corr_sub_, rtcm_msgs::msg::Message, params_.corr_topic_, 100,
+            [this](const rtcm_msgs::msg::Message& msg) {
+                std::unique_lock<std::mutex> lock(driver_mutex_);
+                driver_.SendCorrectionData(msg.message.data(), msg.message.size());
+            },
+            corr_opts);
     }
 
     // Subscribe to wheelspeed input
     if (!params_.speed_topic_.empty()) {
-        _SUB(ws_sub_, fpmsgs::Speed, params_.speed_topic_, 10,
-             [this](const fpmsgs::Speed& msg) { driver_.SendWheelspeedData(SpeedMsgToWheelspeedData(msg)); });
+        _SUB(
+            ws_sub_, fpmsgs::Speed, params_.speed_topic_, 10,
+            [this](const fpmsgs::Speed& msg) {
+                std::unique_lock<std::mutex> lock(driver_mutex_);
+                SpeedMsgToWheelspeedData(msg, ws_data_);
+                driver_.SendWheelspeedData(ws_data_);
+            },
+            speed_opts);
     }
 
     // Subscribe to wheelspeed input
@@ -414,22 +593,35 @@ bool FixpositionDriverNode::StartNode() {
         if (!params_.converter_input_topic_.empty()) {
             switch (params_.converter_topic_type_) {
                 case DriverParams::VelTopicType::TWIST:
-                    _SUB(ws_conv_twist_sub_, geometry_msgs::msg::Twist, params_.converter_input_topic_, 10,
-                         [this](const geometry_msgs::msg::Twist& msg) {
-                             driver_.SendWheelspeedData(Vector3MsgToWheelspeedData(msg.linear, params_));
-                         });
+                    _SUB(
+                        ws_conv_twist_sub_, geometry_msgs::msg::Twist, params_.converter_input_topic_, 10,
+                        [this](const geometry_msgs::msg::Twist& msg) {
+                            std::unique_lock<std::mutex> lock(driver_mutex_);
+                            Vector3MsgToWheelspeedData(msg.linear, params_, ws_data_);
+                            driver_.SendWheelspeedData(ws_data_);
+                        },
+                        speed_opts);
                     break;
                 case DriverParams::VelTopicType::TWISTWITHCOV:
-                    _SUB(ws_conv_twistcov_sub_, geometry_msgs::msg::TwistWithCovariance, params_.converter_input_topic_,
-                         10, [this](const geometry_msgs::msg::TwistWithCovariance& msg) {
-                             driver_.SendWheelspeedData(Vector3MsgToWheelspeedData(msg.twist.linear, params_));
-                         });
+                    _SUB(
+                        ws_conv_twistcov_sub_, geometry_msgs::msg::TwistWithCovariance,
+                        params_.converter_input_topic_, 10,
+                        [this](const geometry_msgs::msg::TwistWithCovariance& msg) {
+                            std::unique_lock<std::mutex> lock(driver_mutex_);
+                            Vector3MsgToWheelspeedData(msg.twist.linear, params_, ws_data_);
+                            driver_.SendWheelspeedData(ws_data_);
+                        },
+                        speed_opts);
                     break;
                 case DriverParams::VelTopicType::ODOMETRY:
-                    _SUB(ws_conv_odom_sub_, nav_msgs::msg::Odometry, params_.converter_input_topic_, 10,
-                         [this](const nav_msgs::msg::Odometry& msg) {
-                             driver_.SendWheelspeedData(Vector3MsgToWheelspeedData(msg.twist.twist.linear, params_));
-                         });
+                    _SUB(
+                        ws_conv_odom_sub_, nav_msgs::msg::Odometry, params_.converter_input_topic_, 10,
+                        [this](const nav_msgs::msg::Odometry& msg) {
+                            std::unique_lock<std::mutex> lock(driver_mutex_);
+                            Vector3MsgToWheelspeedData(msg.twist.twist.linear, params_, ws_data_);
+                            driver_.SendWheelspeedData(ws_data_);
+                        },
+                        speed_opts);
                     break;
                 default:
                     RCLCPP_WARN_THROTTLE(logger_, *nh_->get_clock(), 1e3,
@@ -439,15 +631,34 @@ bool FixpositionDriverNode::StartNode() {
         }
     }
 
-    return driver_.StartDriver();
+    ros_ready_.store(true, std::memory_order_release);
+    RCLCPP_INFO(logger_, "ROS interface ready %.1f ms after start",
+                std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start_time_).count());
 }
 
 #undef _PUB
 #undef _SUB
 
+bool FixpositionDriverNode::RosReady() {
+    if (!ros_ready_.load(std::memory_order_acquire)) {
+        return false;
+    }
+    // Report the time from StartNode() to the first message actually reaching the ROS interface
+    if (!first_msg_logged_.exchange(true)) {
+        RCLCPP_INFO(logger_, "First message published %.1f ms after start",
+                    std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start_time_).count());
+    }
+    return true;
+}
+
 void FixpositionDriverNode::StopNode() {
     RCLCPP_INFO(logger_, "Stopping...");
 
+    // Wait for a still-running ROS interface setup (see StartNode())
+    if (setup_thread_.joinable()) {
+        setup_thread_.join();
+    }
+
     driver_.RemoveFpaObservers();
     driver_.RemoveNmeaObservers();
     driver_.RemoveNovbObservers();
@@ -499,6 +710,9 @@ void FixpositionDriverNode::StopNode() {
     // - Other
     jump_pub_.reset();
     raw_pub_.reset();
+    stats_timer_.reset();
+    stats_pub_.reset();
+    params_cb_handle_.reset();
 
     // Stop input message subscribers
     ws_sub_.reset();
@@ -506,6 +720,8 @@ void FixpositionDriverNode::StopNode() {
     ws_conv_twist_sub_.reset();
     ws_conv_twistcov_sub_.reset();
     ws_conv_odom_sub_.reset();
+    corr_cbgroup_.reset();
+    speed_cbgroup_.reset();
 
     // TF
     tf_br_.reset();
@@ -518,11 +734,18 @@ void FixpositionDriverNode::ProcessTfData(const TfData& tf_data) {
     geometry_msgs::msg::TransformStamped tf;
     TfDataToTransformStamped(tf_data, tf);
 
+    // Change detection and rate decimation for the /tf output (see TfThrottle). Suppressed transforms are
+    // still processed below (IMU YPR output, Nav2 TF storage), only the broadcast is skipped.
+    const bool send_tf =
+        tf_throttle_.Accept(tf_data.frame_id, tf_data.child_frame_id, tf_data.translation, tf_data.rotation);
+
     // TODO: use constants from helper.hpp?
 
     // FP_IMUH -> FP_POI
     if ((tf.child_frame_id == "FP_IMUH") && (tf.header.frame_id == "FP_POI")) {
-        tf_br_->sendTransform(tf);
+        if (send_tf) {
+            tf_br_->sendTransform(tf);
+        }
 
         // Publish pitch roll based on IMU only
         Eigen::Vector3d imu_ypr_eigen = trafo::QuatToEul(tf_data.rotation);
@@ -538,7 +761,9 @@ void FixpositionDriverNode::ProcessTfData(const TfData& tf_data) {
     }
     // FP_POI -> FP_POISH
     else if ((tf.child_frame_id == "FP_POISH") && (tf.header.frame_id == "FP_POI")) {
-        tf_br_->sendTransform(tf);
+        if (send_tf) {
+            tf_br_->sendTransform(tf);
+        }
         // Store  TF if Nav2 mode is enabled
         if (params_.nav2_mode_) {
             std::unique_lock<std::mutex> lock(tfs_.mutex_);
@@ -547,16 +772,31 @@ void FixpositionDriverNode::ProcessTfData(const TfData& tf_data) {
     }
     // FP_ECEF -> FP_ENU0
     else if ((tf.child_frame_id == "FP_ENU0") && (tf.header.frame_id == "FP_ECEF")) {
-        static_br_->sendTransform(tf);
-        // Store TF if Nav2 mode is enabled
+        if (send_tf) {
+            static_br_->sendTransform(tf);
+        }
+        // Store TF if Nav2 mode is enabled, refreshing the cached ENU reference only when the transform actually
+        // changed (it is effectively static after startup), so that PublishNav2Tf() does not have to derive it on
+        // every fusion epoch
         if (params_.nav2_mode_) {
             std::unique_lock<std::mutex> lock(tfs_.mutex_);
+            if (!tfs_.ref_valid_ || !tfs_.t_ecef_enu0_.isApprox(tf_data.translation) ||
+                !tfs_.q_ecef_enu0_.isApprox(tf_data.rotation)) {
+                tfs_.t_ecef_enu0_ = tf_data.translation;
+                tfs_.q_ecef_enu0_ = tf_data.rotation;
+                tfs_.llh_enu0_ = trafo::TfWgs84LlhEcef(tf_data.translation);
+                tfs_.q_enu0_ecef_ = tf_data.rotation.inverse();
+                tfs_.ref_valid_ = true;
+                tfs_.map_dirty_ = true;
+            }
             tfs_.ecef_enu0_ = std::make_unique<geometry_msgs::msg::TransformStamped>(tf);
         }
     }
     // Something else
     else {
-        static_br_->sendTransform(tf);
+        if (send_tf) {
+            static_br_->sendTransform(tf);
+        }
     }
 }
 
@@ -578,7 +818,9 @@ void FixpositionDriverNode::ProcessOdometryData(const OdometryData& odometry_dat
     switch (odometry_data.type) {
         case OdometryData::Type::ODOMETRY:
 
-            if (odometry_data.valid) {
+            if (odometry_data.valid &&
+                tf_throttle_.Accept(odometry_data.frame_id, odometry_data.child_frame_id,
+                                    odometry_data.pose.position, odometry_data.pose.orientation)) {
                 geometry_msgs::msg::TransformStamped tf;
                 OdometryDataToTransformStamped(odometry_data, tf);
                 tf_br_->sendTransform(tf);
@@ -586,7 +828,7 @@ void FixpositionDriverNode::ProcessOdometryData(const OdometryData& odometry_dat
 
             // Output jump warning
             if (params_.cov_warning_ && odometry_data.valid && jump_detector_.Check(odometry_data)) {
-                RCLCPP_WARN(logger_, jump_detector_.warning_.c_str());
+                RCLCPP_WARN(logger_, "%s", jump_detector_.warning_);
                 PublishJumpWarning(jump_detector_, jump_pub_);
             }
 
@@ -618,34 +860,43 @@ void FixpositionDriverNode::ProcessOdometryData(const OdometryData& odometry_dat
 // ---------------------------------------------------------------------------------------------------------------------
 
 void FixpositionDriverNode::PublishNav2Tf() {
-    std::unique_lock<std::mutex> lock(tfs_.mutex_);
-    // We'll need all before we can start publishing the Nav2 TFs
-    if (!tfs_.ecef_enu0_ || !tfs_.poi_poish_ || !tfs_.ecef_poish_ || !tfs_.enu0_poi_) {
-        return;
-    }
-
-    // Publish FP_ECEF -> map
-    tfs_.ecef_enu0_->child_frame_id = "map";
-    static_br_->sendTransform(*tfs_.ecef_enu0_);
-
-    // Compute FP_ENU0 -> FP_POISH
-    // Extract translation and rotation from ECEFENU0
-    geometry_msgs::msg::Vector3 trans_ecef_enu0 = tfs_.ecef_enu0_->transform.translation;
-    geometry_msgs::msg::Quaternion rot_ecef_enu0 = tfs_.ecef_enu0_->transform.rotation;
-    Eigen::Vector3d t_ecef_enu0_;
-    t_ecef_enu0_ << trans_ecef_enu0.x, trans_ecef_enu0.y, trans_ecef_enu0.z;
-    Eigen::Quaterniond q_ecef_enu0_(rot_ecef_enu0.w, rot_ecef_enu0.x, rot_ecef_enu0.y, rot_ecef_enu0.z);
-
-    // Extract translation and rotation from ECEFPOISH
-    geometry_msgs::msg::Vector3 trans_ecef_poish = tfs_.ecef_poish_->transform.translation;
-    geometry_msgs::msg::Quaternion rot_ecef_poish = tfs_.ecef_poish_->transform.rotation;
-    Eigen::Vector3d t_ecef_poish;
-    t_ecef_poish << trans_ecef_poish.x, trans_ecef_poish.y, trans_ecef_poish.z;
-    Eigen::Quaterniond q_ecef_poish(rot_ecef_poish.w, rot_ecef_poish.x, rot_ecef_poish.y, rot_ecef_poish.z);
+    // Snapshot the collected transforms and the cached ENU reference. The mutex is held only for these copies, the
+    // math and the publishing below do not block the collecting observers.
+    geometry_msgs::msg::TransformStamped ecef_enu0;
+    geometry_msgs::msg::TransformStamped ecef_poish;
+    geometry_msgs::msg::TransformStamped enu0_poi;
+    Eigen::Vector3d llh_enu0;
+    Eigen::Quaterniond q_enu0_ecef;
+    bool map_dirty = false;
+    {
+        std::unique_lock<std::mutex> lock(tfs_.mutex_);
+        // We'll need all before we can start publishing the Nav2 TFs
+        if (!tfs_.ecef_enu0_ || !tfs_.poi_poish_ || !tfs_.ecef_poish_ || !tfs_.enu0_poi_) {
+            return;
+        }
+        ecef_enu0 = *tfs_.ecef_enu0_;
+        ecef_poish = *tfs_.ecef_poish_;
+        enu0_poi = *tfs_.enu0_poi_;
+        llh_enu0 = tfs_.llh_enu0_;
+        q_enu0_ecef = tfs_.q_enu0_ecef_;
+        map_dirty = tfs_.map_dirty_;
+        tfs_.map_dirty_ = false;
+    }
 
-    // Compute the ENU transformation
-    const Eigen::Vector3d t_enu0_poish = trafo::TfEnuEcef(t_ecef_poish, trafo::TfWgs84LlhEcef(t_ecef_enu0_));
-    const Eigen::Quaterniond q_enu0_poish = q_ecef_enu0_.inverse() * q_ecef_poish;
+    // Publish FP_ECEF -> map, but only when it changed (the static broadcaster latches it)
+    if (map_dirty) {
+        ecef_enu0.child_frame_id = "map";
+        static_br_->sendTransform(ecef_enu0);
+    }
+
+    // Compute FP_ENU0 -> FP_POISH from the dynamic FP_ECEF -> FP_POISH transform and the cached ENU reference
+    Eigen::Vector3d t_ecef_poish;
+    t_ecef_poish << ecef_poish.transform.translation.x, ecef_poish.transform.translation.y,
+        ecef_poish.transform.translation.z;
+    const Eigen::Quaterniond q_ecef_poish(ecef_poish.transform.rotation.w, ecef_poish.transform.rotation.x,
+                                          ecef_poish.transform.rotation.y, ecef_poish.transform.rotation.z);
+    const Eigen::Vector3d t_enu0_poish = trafo::TfEnuEcef(t_ecef_poish, llh_enu0);
+    const Eigen::Quaterniond q_enu0_poish = q_enu0_ecef * q_ecef_poish;
 
     // Create tf2::Transform tf_ENU0POISH
     tf2::Transform tf_ENU0POISH;
@@ -656,7 +907,7 @@ void FixpositionDriverNode::PublishNav2Tf() {
     // Publish map -> odom
     // Multiply the transforms
     tf2::Transform tf_ENU0POI;
-    tf2::fromMsg(tfs_.enu0_poi_->transform, tf_ENU0POI);
+    tf2::fromMsg(enu0_poi.transform, tf_ENU0POI);
     tf2::Transform tf_combined = tf_ENU0POI * tf_ENU0POISH.inverse();
 
     // Create a new TransformStamped message
@@ -728,20 +979,17 @@ int main(int argc, char** argv) {
         if (node->StartNode()) {
             RCLCPP_INFO(logger, "main() spinning...");
 
-            // Do the same as rclpp::spin(), but also handle CTRL-C / SIGINT nicely
-            // Callbacks execute in main thread
+            // Use multiple spinner threads. Callbacks execute in one of them, partitioned by the node's callback
+            // groups (see FixpositionDriverNode::StartNode()), so that the independent input paths don't serialise
+            // through a single thread. Also handle CTRL-C / SIGINT nicely.
+            rclcpp::executors::MultiThreadedExecutor executor{rclcpp::ExecutorOptions(), 4};
+            executor.add_node(nh);
+            std::thread executor_thread([&executor]() { executor.spin(); });
             while (rclcpp::ok() && !sigint.ShouldAbort()) {
-                rclcpp::spin_until_future_complete(nh, std::promise<bool>().get_future(),
-                                                   std::chrono::milliseconds(337));
+                std::this_thread::sleep_for(std::chrono::milliseconds(337));
             }
-
-            // TODO: we'd rather do this, but it (executing in those threads) doesn't seem to work
-            // Use multiple spinner threads. Callback execute in one of them.
-            // rclcpp::executors::MultiThreadedExecutor executor{ rclcpp::ExecutorOptions(), 4 };
-            // executor.add_node(node);
-            // while (rclcpp::ok() && !sigint.ShouldAbort()) {
-            //     executor.spin_once(std::chrono::milliseconds(345));
-            // }
+            executor.cancel();
+            executor_thread.join();
 
             RCLCPP_INFO(logger, "main() stopping");
         } else {
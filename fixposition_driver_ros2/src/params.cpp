@@ -28,14 +28,27 @@ bool LoadParamsFromRos2(std::shared_ptr<rclcpp::Node>& nh, DriverParams& params)
     bool ok = true;
 
     const std::string STREAM = "stream";
+    const std::string EXTRA_STREAMS = "extra_streams";
     const std::string RECONNECT_DELAY = "reconnect_delay";
+    const std::string RECONNECT_DELAY_MAX = "reconnect_delay_max";
     const std::string DELAY_WARNING = "delay_warning";
     const std::string MESSAGES = "messages";
+    const std::string DECIMATION = "decimation";
     const std::string FUSION_EPOCH = "fusion_epoch";
+    const std::string EPOCH_BATCHING = "epoch_batching";
     const std::string NMEA_EPOCH = "nmea_epoch";
     const std::string RAW_OUTPUT = "raw_output";
+    const std::string RAW_RECORD_PATH = "raw_record_path";
+    const std::string RAW_RECORD_SIZE_MB = "raw_record_size_mb";
+    const std::string SHM_OUTPUT = "shm_output";
     const std::string COV_WARNING = "cov_warning";
     const std::string NAV2_MODE = "nav2_mode";
+    const std::string TF_EPSILON_TRANS = "tf_epsilon_trans";
+    const std::string TF_EPSILON_ROT = "tf_epsilon_rot";
+    const std::string TF_MAX_RATE = "tf_max_rate";
+    const std::string THREAD_SCHED = "thread_sched";
+    const std::string THREAD_PRIO = "thread_prio";
+    const std::string THREAD_CPUS = "thread_cpus";
     const std::string CONVERTER_ENABLED = "converter.enabled";
     const std::string CONVERTER_INPUT_TOPIC = "converter.input_topic";
     const std::string CONVERTER_SCALE_FACTOR = "converter.scale_factor";
@@ -50,14 +63,27 @@ bool LoadParamsFromRos2(std::shared_ptr<rclcpp::Node>& nh, DriverParams& params)
 
     std::string topic_type_string_;
     nh->declare_parameter(STREAM, params.stream_);
+    nh->declare_parameter(EXTRA_STREAMS, params.extra_streams_);
     nh->declare_parameter(RECONNECT_DELAY, params.reconnect_delay_);
+    nh->declare_parameter(RECONNECT_DELAY_MAX, params.reconnect_delay_max_);
     nh->declare_parameter(DELAY_WARNING, params.delay_warning_);
     nh->declare_parameter(MESSAGES, params.messages_);
+    nh->declare_parameter(DECIMATION, params.decimation_);
     nh->declare_parameter(FUSION_EPOCH, params.fusion_epoch_);
+    nh->declare_parameter(EPOCH_BATCHING, params.epoch_batching_);
     nh->declare_parameter(NMEA_EPOCH, "");
     nh->declare_parameter(RAW_OUTPUT, params.raw_output_);
+    nh->declare_parameter(RAW_RECORD_PATH, params.raw_record_path_);
+    nh->declare_parameter(RAW_RECORD_SIZE_MB, params.raw_record_size_mb_);
+    nh->declare_parameter(SHM_OUTPUT, params.shm_output_);
     nh->declare_parameter(COV_WARNING, params.cov_warning_);
     nh->declare_parameter(NAV2_MODE, params.nav2_mode_);
+    nh->declare_parameter(TF_EPSILON_TRANS, params.tf_epsilon_trans_);
+    nh->declare_parameter(TF_EPSILON_ROT, params.tf_epsilon_rot_);
+    nh->declare_parameter(TF_MAX_RATE, params.tf_max_rate_);
+    nh->declare_parameter(THREAD_SCHED, params.thread_sched_);
+    nh->declare_parameter(THREAD_PRIO, params.thread_prio_);
+    nh->declare_parameter(THREAD_CPUS, params.thread_cpus_);
     nh->declare_parameter(CONVERTER_ENABLED, params.converter_enabled_);
     nh->declare_parameter(CONVERTER_INPUT_TOPIC, params.converter_input_topic_);
     nh->declare_parameter(CONVERTER_SCALE_FACTOR, params.converter_scale_factor_);
@@ -74,10 +100,12 @@ bool LoadParamsFromRos2(std::shared_ptr<rclcpp::Node>& nh, DriverParams& params)
         RCLCPP_WARN(logger, "Failed loading %s param", STREAM.c_str());
         ok = false;
     }
+    nh->get_parameter(EXTRA_STREAMS, params.extra_streams_);  // optional
     if (!nh->get_parameter(RECONNECT_DELAY, params.reconnect_delay_)) {
         RCLCPP_WARN(logger, "Failed loading %s param", RECONNECT_DELAY.c_str());
         ok = false;
     }
+    nh->get_parameter(RECONNECT_DELAY_MAX, params.reconnect_delay_max_);  // optional
     if (!nh->get_parameter(DELAY_WARNING, params.delay_warning_)) {
         RCLCPP_WARN(logger, "Failed loading %s param", DELAY_WARNING.c_str());
         ok = false;
@@ -86,10 +114,15 @@ bool LoadParamsFromRos2(std::shared_ptr<rclcpp::Node>& nh, DriverParams& params)
         RCLCPP_WARN(logger, "Failed loading %s param", MESSAGES.c_str());
         ok = false;
     }
+    nh->get_parameter(DECIMATION, params.decimation_);  // optional
     if (!nh->get_parameter(FUSION_EPOCH, params.fusion_epoch_)) {
         RCLCPP_WARN(logger, "Failed loading %s param", FUSION_EPOCH.c_str());
         ok = false;
     }
+    if (!nh->get_parameter(EPOCH_BATCHING, params.epoch_batching_)) {
+        RCLCPP_WARN(logger, "Failed loading %s param", EPOCH_BATCHING.c_str());
+        ok = false;
+    }
     std::string epoch_str;
     if (!nh->get_parameter(NMEA_EPOCH, epoch_str)) {
         RCLCPP_WARN(logger, "Failed loading %s param", NMEA_EPOCH.c_str());
@@ -103,6 +136,9 @@ bool LoadParamsFromRos2(std::shared_ptr<rclcpp::Node>& nh, DriverParams& params)
         RCLCPP_WARN(logger, "Failed loading %s param", RAW_OUTPUT.c_str());
         ok = false;
     }
+    nh->get_parameter(RAW_RECORD_PATH, params.raw_record_path_);        // optional
+    nh->get_parameter(RAW_RECORD_SIZE_MB, params.raw_record_size_mb_);
+    nh->get_parameter(SHM_OUTPUT, params.shm_output_);  // optional
     if (!nh->get_parameter(COV_WARNING, params.cov_warning_)) {
         RCLCPP_WARN(logger, "Failed loading %s param", COV_WARNING.c_str());
         ok = false;
@@ -111,6 +147,12 @@ bool LoadParamsFromRos2(std::shared_ptr<rclcpp::Node>& nh, DriverParams& params)
         RCLCPP_WARN(logger, "Failed loading %s param", NAV2_MODE.c_str());
         ok = false;
     }
+    nh->get_parameter(TF_EPSILON_TRANS, params.tf_epsilon_trans_);  // optional
+    nh->get_parameter(TF_EPSILON_ROT, params.tf_epsilon_rot_);      // optional
+    nh->get_parameter(TF_MAX_RATE, params.tf_max_rate_);            // optional
+    nh->get_parameter(THREAD_SCHED, params.thread_sched_);  // optional
+    nh->get_parameter(THREAD_PRIO, params.thread_prio_);    // optional
+    nh->get_parameter(THREAD_CPUS, params.thread_cpus_);    // optional
     if (!nh->get_parameter(CONVERTER_ENABLED, params.converter_enabled_)) {
         RCLCPP_WARN(logger, "Failed loading %s param", CONVERTER_ENABLED.c_str());
         ok = false;
@@ -168,16 +210,32 @@ bool LoadParamsFromRos2(std::shared_ptr<rclcpp::Node>& nh, DriverParams& params)
     }
 
     RCLCPP_INFO(logger, "DriverParams: stream=%s", params.stream_.c_str());
-    RCLCPP_INFO(logger, "DriverParams: reconnect_delay=%.1f", params.reconnect_delay_);
+    for (std::size_t ix = 0; ix < params.extra_streams_.size(); ix++) {
+        RCLCPP_INFO(logger, "DriverParams: extra_streams[%" PRIuMAX "]=%s", ix, params.extra_streams_[ix].c_str());
+    }
+    RCLCPP_INFO(logger, "DriverParams: reconnect_delay=%.1f reconnect_delay_max=%.1f", params.reconnect_delay_,
+                params.reconnect_delay_max_);
     RCLCPP_INFO(logger, "DriverParams: delay_warning=%.3f", params.delay_warning_);
     for (std::size_t ix = 0; ix < params.messages_.size(); ix++) {
         RCLCPP_INFO(logger, "DriverParams: messages[%" PRIuMAX "]=%s", ix, params.messages_[ix].c_str());
     }
+    for (std::size_t ix = 0; ix < params.decimation_.size(); ix++) {
+        RCLCPP_INFO(logger, "DriverParams: decimation[%" PRIuMAX "]=%s", ix, params.decimation_[ix].c_str());
+    }
     RCLCPP_INFO(logger, "DriverParams: fusion_epoch=%s", params.fusion_epoch_ ? "true" : "false");
+    RCLCPP_INFO(logger, "DriverParams: epoch_batching=%s", params.epoch_batching_ ? "true" : "false");
     RCLCPP_INFO(logger, "DriverParams: nmea_epoch=%s", epoch_str.c_str());
     RCLCPP_INFO(logger, "DriverParams: raw_output=%s", params.raw_output_ ? "true" : "false");
+    RCLCPP_INFO(logger, "DriverParams: raw_record_path=%s", params.raw_record_path_.c_str());
+    RCLCPP_INFO(logger, "DriverParams: raw_record_size_mb=%d", params.raw_record_size_mb_);
+    RCLCPP_INFO(logger, "DriverParams: shm_output=%s", params.shm_output_.c_str());
     RCLCPP_INFO(logger, "DriverParams: cov_warning=%s", params.cov_warning_ ? "true" : "false");
     RCLCPP_INFO(logger, "DriverParams: nav2_mode=%s", params.nav2_mode_ ? "true" : "false");
+    RCLCPP_INFO(logger, "DriverParams: tf_epsilon_trans=%g tf_epsilon_rot=%g tf_max_rate=%g",
+                params.tf_epsilon_trans_, params.tf_epsilon_rot_, params.tf_max_rate_);
+    RCLCPP_INFO(logger, "DriverParams: thread_sched=%s", params.thread_sched_.c_str());
+    RCLCPP_INFO(logger, "DriverParams: thread_prio=%d", params.thread_prio_);
+    RCLCPP_INFO(logger, "DriverParams: thread_cpus=%s", params.thread_cpus_.c_str());
     RCLCPP_INFO(logger, "DriverParams: converter_enabled=%s", params.converter_enabled_ ? "true" : "false");
     RCLCPP_INFO(logger, "DriverParams: converter_topic_type=%s", topic_type_string_.c_str());
     RCLCPP_INFO(logger, "DriverParams: converter_input_topic=%s", params.converter_input_topic_.c_str());